@@ -0,0 +1,502 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <mutex>
+
+// sys...
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// custom...
+#include "BPlus.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+BPlus::BPlus()
+{
+    this->head = new Leaf();
+    this->root = this->head;
+}
+
+BPlus::~BPlus()
+{
+    Clear(this->root, this->levels);
+}
+
+//
+// Methods
+//
+
+void BPlus::Insert(const Node::Value& value, const Node::Label& label)
+{
+    std::unique_lock<std::shared_timed_mutex> guard(this->lock);
+
+    Split split;
+
+    // Keys must stay below the sentinel.
+    if (value >= static_cast<Node::Value>(sentinel))
+    {
+        Node::PrintFailure();
+    }
+
+    else if (Insert(this->root, this->levels, static_cast<std::int32_t>(value), label, split))
+    {
+        // The root split; grow a level above it.
+        if (split.block)
+        {
+            Inner* root = new Inner();
+            root->keys[0] = split.key;
+            root->children[0] = this->root;
+            root->children[1] = split.block;
+            root->count = 1;
+
+            this->root = root;
+            this->levels++;
+        }
+
+        this->size++;
+
+        Node::PrintSuccess();
+    }
+
+    // Value already stored; unsuccessful insert!
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void BPlus::Remove(const Node::Value& value)
+{
+    std::unique_lock<std::shared_timed_mutex> guard(this->lock);
+
+    if (value < static_cast<Node::Value>(sentinel) && Delete(static_cast<std::int32_t>(value)))
+    {
+        Node::PrintSuccess();
+    }
+
+    // Value not stored; unsuccessful remove!
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void BPlus::Remove(unsigned int n)
+{
+    std::unique_lock<std::shared_timed_mutex> guard(this->lock);
+
+    // N-th position unobtainable; unsuccessful remove!
+    if (n >= this->size)
+    {
+        Node::PrintFailure();
+
+        return;
+    }
+
+    // Skip whole leaves until the one holding the n-th value.
+    const Leaf* leaf = this->head;
+    while (n >= leaf->count)
+    {
+        n -= leaf->count;
+        leaf = leaf->next;
+    }
+
+    Delete(leaf->keys[n]);
+
+    Node::PrintSuccess();
+}
+
+void BPlus::Search(const Node::Value& value)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    // Not a storable key; unsuccessful search!
+    if (value >= static_cast<Node::Value>(sentinel))
+    {
+        Node::PrintFailure();
+
+        return;
+    }
+
+    const std::int32_t key = static_cast<std::int32_t>(value);
+    const Block* node = this->root;
+
+    // Route past every separator not above the key.
+    for (unsigned int level = this->levels; level > 1; level--)
+    {
+        node = static_cast<const Inner*>(node)->children[Rank(node, key + 1)];
+    }
+
+    const Leaf* leaf = static_cast<const Leaf*>(node);
+    const unsigned int i = Rank(leaf, key);
+
+    if (i < leaf->count && leaf->keys[i] == key)
+    {
+        Node::Print(leaf->labels[i]);
+    }
+
+    // Value not stored; unsuccessful search!
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void BPlus::Search(const Node::Label& label)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    std::string result;
+
+    for (const Leaf* leaf = this->head; leaf; leaf = leaf->next)
+    {
+        for (unsigned int i = 0; i < leaf->count; i++)
+        {
+            if (leaf->labels[i] == label)
+            {
+                result.append(Node::Pad(leaf->keys[i]));
+                result.append("\n");
+            }
+        }
+    }
+
+    if (!result.empty())
+    {
+        // Print, but remove the last newline insertion.
+        Node::Print(result.substr(0, result.rfind('\n')));
+    }
+
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void BPlus::Print(Node::Order order)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    // Every order lists the labels by value; see the class description.
+    (void) order;
+
+    std::string result;
+
+    for (const Leaf* leaf = this->head; leaf; leaf = leaf->next)
+    {
+        for (unsigned int i = 0; i < leaf->count; i++)
+        {
+            result.append(leaf->labels[i]);
+            result.append(", ");
+        }
+    }
+
+    if (!result.empty())
+    {
+        // Print, but remove the last ", " comma insertion.
+        Node::Print(result.substr(0, result.rfind(',')));
+    }
+
+    else
+    {
+        Node::Print(result);
+    }
+}
+
+void BPlus::Print()
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    Node::Print(std::to_string(this->size ? this->levels : 0));
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr unsigned int BPlus::capacity;
+
+constexpr std::int32_t BPlus::sentinel;
+
+//
+// Construct / Destruct
+//
+
+BPlus::Block::Block()
+{
+    std::fill(this->keys, this->keys + capacity, sentinel);
+}
+
+//
+// Methods
+//
+
+unsigned int BPlus::Rank(const BPlus::Block* node, std::int32_t key)
+{
+#ifdef __SSE2__
+    // Count the keys below the given one, four at a time; the sentinels past the end never are.
+    const __m128i needle = _mm_set1_epi32(key);
+    unsigned int rank = 0;
+
+    for (unsigned int i = 0; i < node->count; i += 4)
+    {
+        const __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(node->keys + i));
+        const int below = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(keys, needle)));
+
+        rank += static_cast<unsigned int>(__builtin_popcount(static_cast<unsigned int>(below)));
+    }
+
+    return rank;
+#else
+    return static_cast<unsigned int>(std::lower_bound(node->keys, node->keys + node->count, key) - node->keys);
+#endif
+}
+
+bool BPlus::Insert(BPlus::Block* node, unsigned int levels, std::int32_t key, const Node::Label& label, BPlus::Split& split)
+{
+    if (levels == 1)
+    {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        unsigned int i = Rank(leaf, key);
+
+        if (i < leaf->count && leaf->keys[i] == key)
+        {
+            return false;
+        }
+
+        // Full; move the upper half into a new leaf after it.
+        if (leaf->count == capacity)
+        {
+            Leaf* right = new Leaf();
+            const unsigned int half = capacity / 2;
+
+            std::copy(leaf->keys + half, leaf->keys + capacity, right->keys);
+            std::fill(leaf->keys + half, leaf->keys + capacity, sentinel);
+            std::move(leaf->labels + half, leaf->labels + capacity, right->labels);
+
+            right->count = capacity - half;
+            leaf->count = half;
+
+            right->prev = leaf;
+            right->next = leaf->next;
+
+            if (leaf->next)
+            {
+                leaf->next->prev = right;
+            }
+
+            leaf->next = right;
+
+            split.key = right->keys[0];
+            split.block = right;
+
+            if (i > half)
+            {
+                leaf = right;
+                i -= half;
+            }
+        }
+
+        std::copy_backward(leaf->keys + i, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+        std::move_backward(leaf->labels + i, leaf->labels + leaf->count, leaf->labels + leaf->count + 1);
+
+        leaf->keys[i] = key;
+        leaf->labels[i] = label;
+        leaf->count++;
+
+        return true;
+    }
+
+    Inner* inner = static_cast<Inner*>(node);
+    unsigned int i = Rank(inner, key + 1);
+
+    Split below;
+
+    if (!Insert(inner->children[i], levels - 1, key, label, below))
+    {
+        return false;
+    }
+
+    // The child didn't split; nothing to route.
+    if (!below.block)
+    {
+        return true;
+    }
+
+    // Full; move the upper half into a new node after it, the middle key going up between them.
+    if (inner->count == capacity)
+    {
+        Inner* right = new Inner();
+        const unsigned int half = capacity / 2;
+
+        std::copy(inner->keys + half + 1, inner->keys + capacity, right->keys);
+        std::copy(inner->children + half + 1, inner->children + capacity + 1, right->children);
+
+        split.key = inner->keys[half];
+        split.block = right;
+
+        std::fill(inner->keys + half, inner->keys + capacity, sentinel);
+        std::fill(inner->children + half + 1, inner->children + capacity + 1, nullptr);
+
+        right->count = capacity - half - 1;
+        inner->count = half;
+
+        if (i > half)
+        {
+            inner = right;
+            i -= half + 1;
+        }
+    }
+
+    std::copy_backward(inner->keys + i, inner->keys + inner->count, inner->keys + inner->count + 1);
+    std::copy_backward(inner->children + i + 1, inner->children + inner->count + 1, inner->children + inner->count + 2);
+
+    inner->keys[i] = below.key;
+    inner->children[i + 1] = below.block;
+    inner->count++;
+
+    return true;
+}
+
+bool BPlus::Delete(std::int32_t key)
+{
+    bool empty = false;
+
+    if (!Remove(this->root, this->levels, key, empty))
+    {
+        return false;
+    }
+
+    // The root routes to a single child; drop a level.
+    while (this->levels > 1 && this->root->count == 0)
+    {
+        Inner* root = static_cast<Inner*>(this->root);
+
+        this->root = root->children[0];
+        this->levels--;
+
+        delete root;
+    }
+
+    this->size--;
+
+    return true;
+}
+
+bool BPlus::Remove(BPlus::Block* node, unsigned int levels, std::int32_t key, bool& empty)
+{
+    if (levels == 1)
+    {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        const unsigned int i = Rank(leaf, key);
+
+        if (i >= leaf->count || leaf->keys[i] != key)
+        {
+            return false;
+        }
+
+        std::copy(leaf->keys + i + 1, leaf->keys + leaf->count, leaf->keys + i);
+        std::move(leaf->labels + i + 1, leaf->labels + leaf->count, leaf->labels + i);
+
+        leaf->count--;
+        leaf->keys[leaf->count] = sentinel;
+        leaf->labels[leaf->count].clear();
+
+        // Empty; unlink it from the leaves, though the root leaf always stays.
+        if (leaf->count == 0 && leaf != this->root)
+        {
+            if (leaf->prev)
+            {
+                leaf->prev->next = leaf->next;
+            }
+
+            else
+            {
+                this->head = leaf->next;
+            }
+
+            if (leaf->next)
+            {
+                leaf->next->prev = leaf->prev;
+            }
+
+            empty = true;
+        }
+
+        return true;
+    }
+
+    Inner* inner = static_cast<Inner*>(node);
+    const unsigned int i = Rank(inner, key + 1);
+
+    bool gone = false;
+
+    if (!Remove(inner->children[i], levels - 1, key, gone))
+    {
+        return false;
+    }
+
+    // The child is empty; drop it along with a separator next to it.
+    if (gone)
+    {
+        Clear(inner->children[i], levels - 1);
+
+        const unsigned int separator = (i > 0) ? i - 1 : 0;
+
+        std::copy(inner->keys + separator + 1, inner->keys + inner->count, inner->keys + separator);
+        std::copy(inner->children + i + 1, inner->children + inner->count + 1, inner->children + i);
+
+        inner->children[inner->count] = nullptr;
+
+        // Routing to a single child left no separator to drop.
+        if (inner->count == 0)
+        {
+            empty = true;
+
+            return true;
+        }
+
+        inner->count--;
+        inner->keys[inner->count] = sentinel;
+    }
+
+    return true;
+}
+
+void BPlus::Clear(BPlus::Block* node, unsigned int levels)
+{
+    if (levels == 1)
+    {
+        delete static_cast<Leaf*>(node);
+
+        return;
+    }
+
+    Inner* inner = static_cast<Inner*>(node);
+
+    for (unsigned int i = 0; i <= inner->count; i++)
+    {
+        if (inner->children[i])
+        {
+            Clear(inner->children[i], levels - 1);
+        }
+    }
+
+    delete inner;
+}
@@ -0,0 +1,230 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_BPLUS_H
+#define PROJECT_1_BPLUS_H
+
+// std...
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+
+// custom...
+#include "Engine.h"
+
+/**
+ * @class BPlus
+ *
+ * @brief Represents an engine storing the values in a B+ tree of wide nodes, so a lookup among
+ * millions of values touches a handful of nodes rather than one per binary level.
+ *
+ * Every node holds up to 64 sorted 32-bit keys in a single array, which is searched by counting the
+ * keys below the one sought, four at a time with SIMD where available; unused slots hold a sentinel
+ * above every key, so the count needs no bounds checks. Inner nodes route to their children by the
+ * smallest key of each child but the first. Leaves hold the labels alongside their keys, and are
+ * linked in key order, so in-order prints and `removeInorder` scan them without descending again.
+ *
+ * Removals never merge nodes; a node is only unlinked once empty, which keeps them simple at the
+ * cost of some space after heavy deletion. Keys must be below 2^31 - 1, which covers every 8-digit
+ * value.
+ *
+ * As the tree has no shape comparable to the AVL tree, pre-order and post-order prints list the
+ * labels by value too, and the level count is the number of levels of nodes. Reads share a lock,
+ * writes take it exclusively.
+ */
+class BPlus : public Engine
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs an empty tree.
+     *
+     * Time complexity: O(1)
+     */
+    BPlus();
+
+    /**
+     * @brief Destroys every node of the tree.
+     *
+     * Time complexity: O(n) where n is the number of values stored.
+     */
+    ~BPlus() override;
+
+    //
+    // Methods
+    //
+
+    void Insert(const Node::Value& value, const Node::Label& label) override;
+
+    void Remove(const Node::Value& value) override;
+
+    void Remove(unsigned int n) override;
+
+    void Search(const Node::Value& value) override;
+
+    void Search(const Node::Label& label) override;
+
+    void Print(Node::Order order) override;
+
+    void Print() override;
+
+private:
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the most keys a node holds.
+     */
+    static constexpr unsigned int capacity = 64;
+
+    /**
+     * @brief Represents the key held by unused slots, above every stored key.
+     */
+    static constexpr std::int32_t sentinel = INT32_MAX;
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Block
+     * @brief Represents what every node starts with: its sorted keys.
+     */
+    struct Block
+    {
+        /**
+         * @brief The keys, sorted; the slots past `count` hold `sentinel`.
+         */
+        std::int32_t keys[capacity];
+
+        /**
+         * @brief The number of keys.
+         */
+        unsigned int count = 0;
+
+        Block();
+    };
+
+    /**
+     * @struct Leaf
+     * @brief Represents a node holding values, and their labels at the same indices.
+     */
+    struct Leaf : Block
+    {
+        Node::Label labels[capacity];
+
+        Leaf* prev = nullptr;
+
+        Leaf* next = nullptr;
+    };
+
+    /**
+     * @struct Inner
+     * @brief Represents a node routing to `count + 1` children: values below `keys[0]` go to the
+     * first child, values from `keys[i - 1]` up to below `keys[i]` to the i-th.
+     */
+    struct Inner : Block
+    {
+        Block* children[capacity + 1] = {};
+    };
+
+    /**
+     * @struct Split
+     * @brief Represents the right half of a node that split, and the smallest key below it.
+     */
+    struct Split
+    {
+        std::int32_t key = 0;
+
+        Block* block = nullptr;
+    };
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Returns the number of keys of the node below the given key.
+     *
+     * Time complexity: O(b) where b is the capacity of a node.
+     */
+    static unsigned int Rank(const Block* node, std::int32_t key);
+
+    /**
+     * @brief Inserts the key below the given node, of the given number of levels, splitting it if full.
+     *
+     * @return `false` if the key was already stored, `true` otherwise.
+     *
+     * Time complexity: O(b * log_b n) where b is the capacity of a node and n the number of values.
+     */
+    static bool Insert(Block* node, unsigned int levels, std::int32_t key, const Node::Label& label, Split& split);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Removes the key from the tree, dropping levels the root no longer needs.
+     *
+     * @return `false` if the key wasn't stored, `true` otherwise.
+     *
+     * Time complexity: O(b * log_b n) where b is the capacity of a node and n the number of values.
+     */
+    bool Delete(std::int32_t key);
+
+    /**
+     * @brief Removes the key from below the given node, of the given number of levels.
+     *
+     * @param empty Set to whether the node was left empty, so its parent must unlink and destroy it.
+     *
+     * @return `false` if the key wasn't stored, `true` otherwise.
+     *
+     * Time complexity: O(b * log_b n) where b is the capacity of a node and n the number of values.
+     */
+    bool Remove(Block* node, unsigned int levels, std::int32_t key, bool& empty);
+
+    /**
+     * @brief Destroys the given node, of the given number of levels, and every node below it.
+     *
+     * Time complexity: O(n) where n is the number of nodes below `node`.
+     */
+    static void Clear(Block* node, unsigned int levels);
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the root of the tree; a leaf while `levels` is one.
+     */
+    Block* root;
+
+    /**
+     * @brief Represents the number of levels of nodes.
+     */
+    unsigned int levels = 1;
+
+    /**
+     * @brief Represents the first leaf in key order.
+     */
+    Leaf* head;
+
+    /**
+     * @brief Represents the number of values stored.
+     */
+    std::size_t size = 0;
+
+    /**
+     * @brief Held shared by reads and exclusively by writes.
+     */
+    std::shared_timed_mutex lock;
+};
+
+#endif //PROJECT_1_BPLUS_H
@@ -0,0 +1,134 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// custom...
+#include "Node.h"
+#include "Tree.h"
+
+/**
+ * @struct Operation
+ * @brief Represents a single step of a workload.
+ */
+struct Operation
+{
+    bool insert;
+
+    std::uint32_t value;
+};
+
+/**
+ * @brief Builds a workload of `n` operations on values below `range`, inserting with the given probability.
+ */
+static std::vector<Operation> Workload(std::size_t n, std::uint32_t range, double inserts, std::uint64_t seed)
+{
+    std::mt19937_64 random(seed);
+    std::uniform_int_distribution<std::uint32_t> values(0, range - 1);
+    std::bernoulli_distribution coin(inserts);
+
+    std::vector<Operation> operations(n);
+    for (Operation& operation : operations)
+    {
+        operation.insert = coin(random);
+        operation.value = values(random);
+    }
+
+    return operations;
+}
+
+/**
+ * @brief Prefills a tree with `n` random values below `range` under the given balancing policy, then
+ * runs the workload through `Tree::Insert` and `Tree::Remove` and prints one row of results.
+ */
+static void Run(Node::Balance balance, const std::string& policy, const std::string& workload, std::size_t prefill,
+                std::uint32_t range, const std::vector<Operation>& operations)
+{
+    Node::Rebalance(balance);
+
+    Tree tree;
+
+    for (const Operation& operation : Workload(prefill, range, 1.0, 7))
+    {
+        tree.Insert(operation.value, "Student");
+    }
+
+    const std::size_t before = Node::Rotations();
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const Operation& operation : operations)
+    {
+        if (operation.insert)
+        {
+            tree.Insert(operation.value, "Student");
+        }
+
+        else
+        {
+            tree.Remove(static_cast<Node::Value>(operation.value));
+        }
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double rotations = static_cast<double>(Node::Rotations() - before) / operations.size();
+
+    // The level count, as `printLevelCount` prints it.
+    std::ostringstream height;
+    std::ostream* previous = Node::Redirect(&height);
+    tree.Print();
+    Node::Redirect(previous);
+
+    std::cout << policy << "\t" << workload << "\t" << operations.size() << "\t" << rotations << "\t"
+              << static_cast<unsigned long long>(operations.size() / seconds) << "\t" << height.str() << std::flush;
+}
+
+/**
+ * @brief Benchmarks the `AVL` and `WAVL` balancing policies of `Node` on insert-only, mixed, and
+ * delete-heavy workloads, reporting rotations per operation, throughput, and the final height.
+ *
+ * Usage: `balance_bench [n]`, defaulting to one million operations per workload.
+ */
+int main(int argc, char** argv)
+{
+    const std::size_t n = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+    const std::uint32_t range = static_cast<std::uint32_t>(2 * n);
+
+    struct Case
+    {
+        std::string name;
+
+        std::size_t prefill;
+
+        double inserts;
+    };
+
+    const std::vector<Case> cases = {
+        { "insert", 0, 1.0 },
+        { "mixed", n / 2, 0.5 },
+        { "delete-heavy", n, 0.25 },
+    };
+
+    // The `Node` API prints its results; discard them.
+    std::ostream discard(nullptr);
+    Node::Redirect(&discard);
+
+    std::cout << "policy\tworkload\tops\trotations/op\tops/s\theight" << std::endl;
+
+    for (const Case& test : cases)
+    {
+        const std::vector<Operation> operations = Workload(n, range, test.inserts, 42);
+
+        Run(Node::Balance::AVL, "avl", test.name, test.prefill, range, operations);
+        Run(Node::Balance::WAVL, "wavl", test.name, test.prefill, range, operations);
+    }
+
+    return 0;
+}
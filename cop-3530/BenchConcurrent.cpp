@@ -0,0 +1,260 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// custom...
+#include "Concurrent.h"
+#include "Node.h"
+#include "Tree.h"
+
+/**
+ * @brief Runs the given work on the given number of threads, each receiving its index.
+ *
+ * @return The wall-clock time taken, in seconds.
+ */
+static double Time(unsigned int threads, const std::function<void(unsigned int)>& work)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (unsigned int t = 0; t < threads; t++)
+    {
+        workers.emplace_back(work, t);
+    }
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Prints one row of results.
+ */
+static void Report(const std::string& tree, const std::string& phase, unsigned int threads, std::size_t ops, double seconds)
+{
+    std::cout << tree << "\t" << phase << "\t" << threads << "\t" << ops << "\t"
+              << static_cast<unsigned long long>(ops / seconds) << std::endl;
+}
+
+/**
+ * @brief Returns whether the churn phase re-inserts the i-th value after removing it; one in four is.
+ */
+static bool Kept(std::size_t i)
+{
+    return i % 4 == 0;
+}
+
+/**
+ * @brief Benchmarks multi-threaded insertion of disjoint values followed by multi-threaded searches,
+ * then a remove-heavy churn in which each thread removes its values, searches, and re-inserts one in
+ * four, comparing the fine-grained `Concurrent` tree against the `Node` tree behind a single mutex.
+ *
+ * Usage: `concurrent_bench [n] [threads...]`, defaulting to one million values on 1, 2, 4, ... up to
+ * one thread per core.
+ */
+int main(int argc, char** argv)
+{
+    const std::size_t n = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+
+    std::vector<unsigned int> counts;
+    for (int i = 2; i < argc; i++)
+    {
+        counts.push_back(static_cast<unsigned int>(std::stoul(argv[i])));
+    }
+
+    if (counts.empty())
+    {
+        const unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+
+        for (unsigned int t = 1; t < cores; t *= 2)
+        {
+            counts.push_back(t);
+        }
+
+        counts.push_back(cores);
+    }
+
+    // Distinct 8-digit values in random order.
+    std::vector<Node::Value> values(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        values[i] = i * (99999999 / std::max<std::size_t>(n, 1));
+    }
+
+    std::shuffle(values.begin(), values.end(), std::mt19937_64(42));
+
+    // The values left after the churn; it removes, searches, and re-inserts.
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        kept += Kept(i);
+    }
+
+    // The `Node` API prints its results; discard them.
+    std::ostream discard(nullptr);
+
+    std::cout << "tree\tphase\tthreads\tops\tops/s" << std::endl;
+
+    for (unsigned int threads : counts)
+    {
+        // Each thread inserts its own slice, then searches the whole range.
+        const auto slice = [&](unsigned int t, std::size_t& begin, std::size_t& end)
+        {
+            begin = n * t / threads;
+            end = n * (t + 1) / threads;
+        };
+
+        {
+            Concurrent tree;
+            std::vector<std::size_t> found(threads, 0);
+
+            Report("concurrent", "insert", threads, n, Time(threads, [&](unsigned int t)
+            {
+                std::size_t begin;
+                std::size_t end;
+                slice(t, begin, end);
+
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    tree.Insert(values[i], "Student");
+                }
+            }));
+
+            Report("concurrent", "search", threads, n, Time(threads, [&](unsigned int t)
+            {
+                std::size_t begin;
+                std::size_t end;
+                slice(t, begin, end);
+
+                Node::Label label;
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    found[t] += tree.Search(values[(i * 7919) % n], label);
+                }
+            }));
+
+            std::size_t total = 0;
+            for (std::size_t f : found)
+            {
+                total += f;
+            }
+
+            if (tree.Size() != n || total != n)
+            {
+                std::cerr << "concurrent tree lost values: size " << tree.Size() << ", found " << total << std::endl;
+
+                return 1;
+            }
+
+            Report("concurrent", "churn", threads, 2 * n + kept, Time(threads, [&](unsigned int t)
+            {
+                std::size_t begin;
+                std::size_t end;
+                slice(t, begin, end);
+
+                Node::Label label;
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    tree.Remove(values[i]);
+                    tree.Search(values[(i * 7919) % n], label);
+
+                    if (Kept(i))
+                    {
+                        tree.Insert(values[i], "Student");
+                    }
+                }
+            }));
+
+            if (tree.Size() != kept)
+            {
+                std::cerr << "concurrent tree kept " << tree.Size() << " values, not " << kept << std::endl;
+
+                return 1;
+            }
+        }
+
+        {
+            Tree tree;
+            std::mutex lock;
+
+            Report("node+mutex", "insert", threads, n, Time(threads, [&](unsigned int t)
+            {
+                Node::Redirect(&discard);
+
+                std::size_t begin;
+                std::size_t end;
+                slice(t, begin, end);
+
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+
+                    tree.Insert(values[i], "Student");
+                }
+            }));
+
+            Report("node+mutex", "search", threads, n, Time(threads, [&](unsigned int t)
+            {
+                Node::Redirect(&discard);
+
+                std::size_t begin;
+                std::size_t end;
+                slice(t, begin, end);
+
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+
+                    tree.Search(values[(i * 7919) % n]);
+                }
+            }));
+
+            Report("node+mutex", "churn", threads, 2 * n + kept, Time(threads, [&](unsigned int t)
+            {
+                Node::Redirect(&discard);
+
+                std::size_t begin;
+                std::size_t end;
+                slice(t, begin, end);
+
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    {
+                        std::lock_guard<std::mutex> guard(lock);
+
+                        tree.Remove(values[i]);
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> guard(lock);
+
+                        tree.Search(values[(i * 7919) % n]);
+                    }
+
+                    if (Kept(i))
+                    {
+                        std::lock_guard<std::mutex> guard(lock);
+
+                        tree.Insert(values[i], "Student");
+                    }
+                }
+            }));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// custom...
+#include "Grams.h"
+#include "Node.h"
+#include "Tree.h"
+
+/**
+ * @brief Runs the given work once.
+ *
+ * @return The wall-clock time taken, in seconds.
+ */
+static double Time(const std::function<void()>& work)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    work();
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Prints one row of results.
+ */
+static void Report(const std::string& tree, const std::string& phase, std::size_t ops, double seconds)
+{
+    std::cout << tree << "\t" << phase << "\t" << ops << "\t" << static_cast<unsigned long long>(ops / seconds) << std::endl;
+}
+
+/**
+ * @brief Benchmarks the `Grams` index on inserting distinct 8-digit values in random order, so
+ * nearly every insert lands inside its posting lists rather than at their ends, removing some of them
+ * in another random order, and fuzzy searches; the AVL `Node` tree inserting and removing the same
+ * values is the baseline.
+ *
+ * Usage: `grams_bench [n] [removes] [searches]`, defaulting to one hundred thousand values, twenty
+ * thousand removals, and a thousand searches.
+ */
+int main(int argc, char** argv)
+{
+    const std::size_t n = (argc > 1) ? std::stoul(argv[1]) : 100000;
+    const std::size_t removes = std::min(n, (argc > 2) ? std::stoul(argv[2]) : 20000);
+    const std::size_t searches = (argc > 3) ? std::stoul(argv[3]) : 1000;
+
+    const std::vector<std::string> syllables = { "an", "bo", "ca", "di", "el", "fa", "gu", "hi", "ko", "la",
+                                                 "mi", "no", "ra", "sa", "ti", "vo", "ya", "ze" };
+
+    // Distinct 8-digit values in random order, labelled with names of two words of two to four syllables.
+    std::mt19937_64 random(42);
+    std::vector<std::uint32_t> values(n);
+    std::vector<Node::Label> labels(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        values[i] = static_cast<std::uint32_t>(i * (99999999 / std::max<std::size_t>(n, 1)));
+
+        for (int word = 0; word < 2; word++)
+        {
+            const std::size_t length = 2 + random() % 3;
+
+            for (std::size_t j = 0; j < length; j++)
+            {
+                labels[i] += syllables[random() % syllables.size()];
+            }
+
+            labels[i] += (word == 0) ? " " : "";
+        }
+    }
+
+    std::shuffle(values.begin(), values.end(), random);
+
+    std::vector<std::uint32_t> removed(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(removes));
+    std::shuffle(removed.begin(), removed.end(), random);
+
+    // Both print their results; discard them.
+    std::ostream discard(nullptr);
+    Node::Redirect(&discard);
+
+    std::cout << "tree\tphase\tops\tops/s" << std::endl;
+
+    {
+        Tree tree;
+
+        Report("avl", "insert", n, Time([&]()
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                tree.Insert(values[i], labels[i]);
+            }
+        }));
+
+        Report("avl", "remove", removes, Time([&]()
+        {
+            for (const std::uint32_t value : removed)
+            {
+                tree.Remove(static_cast<Node::Value>(value));
+            }
+        }));
+    }
+
+    {
+        Grams grams;
+
+        Report("grams", "insert", n, Time([&]()
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                grams.Add(labels[i], values[i]);
+            }
+        }));
+
+        Report("grams", "remove", removes, Time([&]()
+        {
+            for (const std::uint32_t value : removed)
+            {
+                grams.Remove(value);
+            }
+        }));
+
+        Report("grams", "searchFuzzy", searches, Time([&]()
+        {
+            for (std::size_t i = 0; i < searches; i++)
+            {
+                grams.Search(labels[i % n].substr(1), 10);
+            }
+        }));
+
+        std::cout << "grams: " << grams.Size() << " ids, " << grams.Count() << " trigrams, " << grams.Bytes() << " bytes" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// custom...
+#include "Node.h"
+#include "Radix.h"
+#include "Tree.h"
+
+/**
+ * @brief Runs the given work once.
+ *
+ * @return The wall-clock time taken, in seconds.
+ */
+static double Time(const std::function<void()>& work)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    work();
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Prints one row of results.
+ */
+static void Report(const std::string& tree, const std::string& phase, std::size_t ops, double seconds)
+{
+    std::cout << tree << "\t" << phase << "\t" << ops << "\t" << static_cast<unsigned long long>(ops / seconds) << std::endl;
+}
+
+/**
+ * @brief Benchmarks the `Radix` engine against the AVL `Node` tree on inserting distinct random
+ * 8-digit values, searching for every one of them in another order, and printing them in order.
+ *
+ * Usage: `radix_bench [n] [prints]`, defaulting to one million values and ten in-order prints.
+ */
+int main(int argc, char** argv)
+{
+    const std::size_t n = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+    const std::size_t prints = (argc > 2) ? std::stoul(argv[2]) : 10;
+
+    // Distinct 8-digit values in random order.
+    std::mt19937_64 random(42);
+    std::vector<Node::Value> values(n);
+    for (std::size_t i = 0; i < n; i++)
+    {
+        values[i] = i * (99999999 / std::max<std::size_t>(n, 1)) + random() % std::max<std::size_t>(1, 99999999 / std::max<std::size_t>(n, 1));
+    }
+
+    std::shuffle(values.begin(), values.end(), random);
+
+    std::vector<Node::Value> searches(values);
+    std::shuffle(searches.begin(), searches.end(), random);
+
+    // Both trees print their results; discard them.
+    std::ostream discard(nullptr);
+    Node::Redirect(&discard);
+
+    std::cout << "tree\tphase\tops\tops/s" << std::endl;
+
+    {
+        Tree tree;
+
+        Report("avl", "insert", n, Time([&]()
+        {
+            for (const Node::Value& value : values)
+            {
+                tree.Insert(value, "Student");
+            }
+        }));
+
+        Report("avl", "search", n, Time([&]()
+        {
+            for (const Node::Value& value : searches)
+            {
+                tree.Search(value);
+            }
+        }));
+
+        Report("avl", "printInorder", prints, Time([&]()
+        {
+            for (std::size_t i = 0; i < prints; i++)
+            {
+                tree.Print(Node::Order::LNR);
+            }
+        }));
+    }
+
+    {
+        Radix tree;
+
+        Report("art", "insert", n, Time([&]()
+        {
+            for (const Node::Value& value : values)
+            {
+                tree.Insert(value, "Student");
+            }
+        }));
+
+        Report("art", "search", n, Time([&]()
+        {
+            for (const Node::Value& value : searches)
+            {
+                tree.Search(value);
+            }
+        }));
+
+        Report("art", "printInorder", prints, Time([&]()
+        {
+            for (std::size_t i = 0; i < prints; i++)
+            {
+                tree.Print(Node::Order::LNR);
+            }
+        }));
+    }
+
+    return 0;
+}
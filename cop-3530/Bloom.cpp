@@ -0,0 +1,144 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+
+// custom...
+#include "Bloom.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Bloom::Bloom(const Node* root)
+{
+    this->capacity = std::max(minimum, 2 * Count(root));
+    this->length = (this->capacity * density + 511) / 512;
+
+    // Value-initialized, so every bit starts cleared.
+    this->memory.reset(new std::atomic<std::uint64_t>[(this->length + 1) * words]());
+
+    // Skip ahead to the first cache line boundary.
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(this->memory.get());
+    this->blocks = this->memory.get() + ((64 - address % 64) % 64) / sizeof(std::uint64_t);
+
+    Fill(root);
+}
+
+//
+// Methods
+//
+
+void Bloom::Add(std::uint32_t value)
+{
+    const std::uint64_t hash = Hash::Mix(value);
+    std::atomic<std::uint64_t>* block = Block(hash);
+
+    for (std::size_t i = 0; i < words; i++)
+    {
+        const std::uint32_t bit = (static_cast<std::uint32_t>(hash) * salts[i]) >> 26;
+
+        block[i].fetch_or(std::uint64_t(1) << bit, std::memory_order_relaxed);
+    }
+
+    this->count++;
+}
+
+bool Bloom::Contains(std::uint64_t value) const
+{
+    // Beyond 32 bits; never added.
+    if (value >> 32)
+    {
+        return false;
+    }
+
+    const std::uint64_t hash = Hash::Mix(static_cast<std::uint32_t>(value));
+    const std::atomic<std::uint64_t>* block = Block(hash);
+
+    for (std::size_t i = 0; i < words; i++)
+    {
+        const std::uint32_t bit = (static_cast<std::uint32_t>(hash) * salts[i]) >> 26;
+
+        if (!((block[i].load(std::memory_order_relaxed) >> bit) & 1))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Bloom::Full() const
+{
+    return this->count >= this->capacity;
+}
+
+std::size_t Bloom::Bytes() const
+{
+    return sizeof(*this) + (this->length + 1) * words * sizeof(std::uint64_t);
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr std::size_t Bloom::minimum;
+
+constexpr std::size_t Bloom::density;
+
+constexpr std::size_t Bloom::words;
+
+const std::uint32_t Bloom::salts[Bloom::words] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+    0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U,
+};
+
+//
+// Static Methods
+//
+
+std::size_t Bloom::Count(const Node* root)
+{
+    // Base case.
+    if (!root)
+    {
+        return 0;
+    }
+
+    return Count(root->nodeL) + 1 + Count(root->nodeR);
+}
+
+//
+// Methods
+//
+
+std::atomic<std::uint64_t>* Bloom::Block(std::uint64_t hash) const
+{
+    // The upper half of the hash scaled to the number of blocks; the lower half picks the bits.
+    return this->blocks + ((hash >> 32) * this->length >> 32) * words;
+}
+
+void Bloom::Fill(const Node* root)
+{
+    // Base case.
+    if (!root)
+    {
+        return;
+    }
+
+    Fill(root->nodeL);
+    Add(static_cast<std::uint32_t>(root->value));
+    Fill(root->nodeR);
+}
@@ -0,0 +1,168 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_BLOOM_H
+#define PROJECT_1_BLOOM_H
+
+// std...
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// custom...
+#include "Hash.h"
+#include "Node.h"
+
+/**
+ * @class Bloom
+ *
+ * @brief Represents a blocked Bloom filter of 32-bit values, telling for certain that a value is
+ * absent from a tree without touching its nodes; a value it reports present may still be absent.
+ *
+ * The filter is an array of 512-bit blocks, each one cache line. A value hashes to a single block,
+ * and sets one bit in each of its eight 64-bit words, so a lookup reads a single cache line. Sized
+ * at 12 bits per value, about one absent value in 250 is reported present once it's full.
+ *
+ * Bits are only ever set, atomically, so values may be added while others are looked up without a
+ * lock, and a value once added is reported present for as long as the filter lives. Removed values
+ * thus keep being reported present until the filter is rebuilt; so do values added beyond its
+ * capacity, which is twice the number of values it was built from.
+ */
+class Bloom
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs a filter of every value of the tree rooted at the given node.
+     *
+     * @param root The root of the tree to be read.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    explicit Bloom(const Node* root);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Adds the given value.
+     *
+     * Time complexity: O(1)
+     */
+    void Add(std::uint32_t value);
+
+    /**
+     * @brief Checks if the given value may be present.
+     *
+     * @return `false` if the value is certainly absent, `true` otherwise.
+     *
+     * Time complexity: O(1)
+     */
+    bool Contains(std::uint64_t value) const;
+
+    /**
+     * @brief Checks if the filter holds as many values as it was sized for, so it should be rebuilt.
+     *
+     * Time complexity: O(1)
+     */
+    bool Full() const;
+
+    /**
+     * @brief Returns the number of bytes held, the filter itself included.
+     *
+     * Time complexity: O(1)
+     */
+    std::size_t Bytes() const;
+
+private:
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the fewest values a filter is sized for.
+     */
+    static constexpr std::size_t minimum = 1 << 16;
+
+    /**
+     * @brief Represents the number of bits per value a filter is sized with.
+     */
+    static constexpr std::size_t density = 12;
+
+    /**
+     * @brief Represents the number of 64-bit words of a block.
+     */
+    static constexpr std::size_t words = 8;
+
+    /**
+     * @brief Represents the odd multipliers picking the bit set in each word of a block.
+     */
+    static const std::uint32_t salts[words];
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Returns the number of nodes of the tree rooted at the given node.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    static std::size_t Count(const Node* root);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Returns the first word of the block the given hash falls in.
+     *
+     * Time complexity: O(1)
+     */
+    std::atomic<std::uint64_t>* Block(std::uint64_t hash) const;
+
+    /**
+     * @brief Adds every value of the tree rooted at the given node.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    void Fill(const Node* root);
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the memory allocated for the blocks, with a block to spare for aligning them.
+     */
+    std::unique_ptr<std::atomic<std::uint64_t>[]> memory;
+
+    /**
+     * @brief Represents the first word of the first block, aligned to a cache line.
+     */
+    std::atomic<std::uint64_t>* blocks;
+
+    /**
+     * @brief Represents the number of blocks.
+     */
+    std::size_t length;
+
+    /**
+     * @brief Represents the number of values the filter is sized for.
+     */
+    std::size_t capacity;
+
+    /**
+     * @brief Represents the number of values added; only ever read and written by writers.
+     */
+    std::size_t count = 0;
+};
+
+#endif //PROJECT_1_BLOOM_H
@@ -3,11 +3,26 @@
 //
 
 // std...
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
 
 // custom...
+#include "BPlus.h"
 #include "Clap.h"
+#include "Epoch.h"
+#include "Journal.h"
+#include "Radix.h"
+#include "Server.h"
+#include "Shards.h"
+#include "Snapshot.h"
+#include "Versions.h"
 
 
 //
@@ -18,15 +33,260 @@
 // Static Methods
 //
 
-void Clap::Run()
+int Clap::Run(int argc, char** argv)
 {
-    unsigned int numCommands;
-    std::cin >> numCommands;
+    const Args flags(argv + 1, argv + argc);
 
-    // Ignore the newline.
-    std::cin.ignore();
+    Arg path;
+    Arg journal;
+    Arg backend;
+    Arg index;
+    Arg balance;
+    unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int shards = 0;
+    std::size_t window = 64;
+    std::size_t budget = 64 << 20;
+    std::size_t cache = 0;
+    bool filter = false;
+    bool names = false;
+    bool fuzzy = false;
 
-    Parse(numCommands);
+    // Try to read the flags.
+    try
+    {
+        for (std::size_t i = 0; i < flags.size(); i++)
+        {
+            if (flags.at(i) == "--serve")
+            {
+                path = flags.at(++i);
+            }
+
+            else if (flags.at(i) == "--threads")
+            {
+                threads = std::max(1, std::stoi(flags.at(++i)));
+            }
+
+            else if (flags.at(i) == "--shards")
+            {
+                shards = std::max(1, std::stoi(flags.at(++i)));
+            }
+
+            else if (flags.at(i) == "--engine")
+            {
+                backend = flags.at(++i);
+
+                if (backend != "art" && backend != "bplus")
+                {
+                    throw std::invalid_argument(backend);
+                }
+            }
+
+            else if (flags.at(i) == "--index")
+            {
+                index = flags.at(++i);
+
+                if (index != "fast" && index != "compact")
+                {
+                    throw std::invalid_argument(index);
+                }
+            }
+
+            else if (flags.at(i) == "--balance")
+            {
+                balance = flags.at(++i);
+
+                if (balance != "avl" && balance != "wavl")
+                {
+                    throw std::invalid_argument(balance);
+                }
+            }
+
+            else if (flags.at(i) == "--filter")
+            {
+                filter = true;
+            }
+
+            else if (flags.at(i) == "--cache")
+            {
+                cache = std::stoul(flags.at(++i));
+            }
+
+            else if (flags.at(i) == "--names")
+            {
+                names = true;
+            }
+
+            else if (flags.at(i) == "--fuzzy")
+            {
+                fuzzy = true;
+            }
+
+            else if (flags.at(i) == "--journal")
+            {
+                journal = flags.at(++i);
+            }
+
+            else if (flags.at(i) == "--retain")
+            {
+                window = std::stoul(flags.at(++i));
+            }
+
+            else if (flags.at(i) == "--budget")
+            {
+                budget = std::stoul(flags.at(++i));
+            }
+
+            else if (flags.at(i) == "--mode")
+            {
+                const Arg& mode = flags.at(++i);
+
+                if (mode == "rwl")
+                {
+                    Clap::mode = Mode::RWL;
+                }
+
+                else if (mode == "ebr")
+                {
+                    Clap::mode = Mode::EBR;
+                }
+
+                else if (mode == "mvcc")
+                {
+                    Clap::mode = Mode::MVCC;
+                }
+
+                else
+                {
+                    throw std::invalid_argument(mode);
+                }
+            }
+
+            else
+            {
+                throw std::invalid_argument(flags.at(i));
+            }
+        }
+    }
+
+    // Flags couldn't be properly read.
+    catch (...)
+    {
+        std::cerr << "usage: " << argv[0] << " [--mode rwl|ebr|mvcc [--retain <n>] [--budget <bytes>] | --shards <n> | --engine art|bplus] [--balance avl|wavl] [--filter] [--index fast|compact] [--cache <n>] [--names] [--fuzzy] [--journal <path>] [--serve <path> [--threads <n>]]" << std::endl;
+
+        return 1;
+    }
+
+    Versions::Retain(window, budget);
+
+    // Balance every tree by rank instead, before any is built.
+    if (balance == "wavl")
+    {
+        Node::Rebalance(Node::Balance::WAVL);
+    }
+
+    std::unique_ptr<Engine> engine;
+
+    // Partition the tree across shards instead of keeping a single tree.
+    if (shards)
+    {
+        engine.reset(new Shards(shards));
+    }
+
+    // Keep the values in a radix tree instead.
+    else if (backend == "art")
+    {
+        engine.reset(new Radix());
+    }
+
+    // Keep the values in a B+ tree instead.
+    else if (backend == "bplus")
+    {
+        engine.reset(new BPlus());
+    }
+
+    Clap::engine = engine.get();
+
+    // Filter and index every tree from the start, so every ID added to one is added to them too.
+    if (!Clap::engine)
+    {
+        Clap::options.filter = filter;
+        Clap::options.cache = cache;
+        Clap::options.names = names;
+        Clap::options.fuzzy = fuzzy;
+
+        // Tables are only possible while the nodes are modified in place.
+        if (Clap::mode == Mode::RWL)
+        {
+            Clap::options.index = index;
+        }
+    }
+
+    Clap::trees.emplace(Clap::tree, Index(nullptr));
+    Clap::current = Clap::trees.at(Clap::tree);
+
+    int status = 0;
+
+    // Rebuild the trees from the journal, silently, before logging anything new to it.
+    if (!journal.empty())
+    {
+        std::ostream null(nullptr);
+        std::ostream* previous = Node::Redirect(&null);
+
+        const bool opened = Journal::Open(journal, [](const Journal::Record& record)
+        {
+            for (const std::string& line : record)
+            {
+                Command command;
+                Args args;
+
+                Split(line, command, args);
+                Execute(command, args);
+            }
+        });
+
+        Node::Redirect(previous);
+
+        if (!opened)
+        {
+            std::cerr << "unable to open journal " << journal << std::endl;
+
+            status = 1;
+        }
+    }
+
+    // Journal unusable; nothing to run.
+    if (status)
+    {
+        // Do nothing...
+    }
+
+    // Serve clients instead of reading the standard input.
+    else if (!path.empty())
+    {
+        status = Server::Run(path, threads) ? 0 : 1;
+    }
+
+    else
+    {
+        unsigned int numCommands;
+        std::cin >> numCommands;
+
+        // Ignore the newline.
+        std::cin.ignore();
+
+        Parse(numCommands);
+    }
+
+    Clap::engine = nullptr;
+
+    Journal::Close();
+
+    // Destroy every named tree, the one in use included.
+    std::atomic_store(&Clap::current, std::shared_ptr<State>());
+
+    Clap::trees.clear();
+
+    return status;
 }
 
 
@@ -38,7 +298,39 @@ void Clap::Run()
 // Define Static Properties
 //
 
-Node* Clap::root = nullptr;
+Clap::Options Clap::options;
+
+std::unordered_map<std::string, std::shared_ptr<Clap::State>> Clap::trees;
+
+std::shared_ptr<Clap::State> Clap::current;
+
+std::string Clap::tree = "default";
+
+Clap::Counters Clap::counters;
+
+Clap::Mode Clap::mode = Clap::Mode::RWL;
+
+std::shared_timed_mutex Clap::lock;
+
+std::atomic<unsigned long long> Clap::writes(0);
+
+Clap::Transaction Clap::console;
+
+thread_local Clap::Transaction* Clap::transaction = &Clap::console;
+
+Engine* Clap::engine = nullptr;
+
+//
+// Construct / Destruct
+//
+
+Clap::Transaction::~Transaction()
+{
+    for (Node* node : this->fresh)
+    {
+        delete node;
+    }
+}
 
 //
 // Static Methods
@@ -92,126 +384,157 @@ void Clap::Parse(unsigned int n)
         // Get the string input from the user.
         std::getline(std::cin, line);
 
-        // Need to parse as stream.
-        std::istringstream iss(line);
-
-        // Set command first.
         Command command;
-        iss >> command;
-
         Args args;
-        Arg arg;
 
-        while(iss >> arg)
-        {
-            unsigned int limit = 0;
-            while(arg.front() == '"' && arg.back() != '"' && limit <= 3)
-            {
-                Arg temp;
+        Split(line, command, args);
+        Execute(command, args);
+    }
+}
+
+void Clap::Split(const std::string& line, Clap::Command& command, Clap::Args& args)
+{
+    // Need to parse as stream.
+    std::istringstream iss(line);
 
-                iss >> temp;
+    // Set command first.
+    iss >> command;
 
-                arg.append(" " + temp);
-                limit++;
-            }
+    Arg arg;
+
+    while(iss >> arg)
+    {
+        unsigned int limit = 0;
+        while(arg.front() == '"' && arg.back() != '"' && limit <= 3)
+        {
+            Arg temp;
+
+            iss >> temp;
 
-            args.push_back(arg);
+            arg.append(" " + temp);
+            limit++;
         }
 
-        Execute(command, args);
+        args.push_back(arg);
     }
 }
 
 void Clap::Execute(const Clap::Command& command, const Clap::Args& args)
 {
-    // Base case sanity check.
-    if (command.empty())
+    // Transactions stage commands against their working copy, which no writer may change meanwhile.
+    if (command == "begin" || command == "rollback" || (Clap::transaction->open && command != "commit"))
     {
-        // Do nothing...
+        std::shared_lock<std::shared_timed_mutex> guard(Clap::lock);
+
+        Stage(command, args);
     }
 
-    else if (command == "insert")
+    // Engines synchronize themselves.
+    else if (Clap::engine && Reader(command))
     {
-        Node::Value value;
-        Node::Label label;
+        Read(command, args, nullptr, nullptr);
+    }
 
-        // Try to access args.
-        try
-        {
-            value = std::stoull(args.at(1));
-            label = args.at(0);
-        }
+    else if (Clap::engine)
+    {
+        Write(command, args);
+    }
 
-        // Args couldn't be properly accessed.
-        catch (...)
-        {
-            Node::PrintFailure();
+    // Readers of the IDs hold the lock in every mode, as writers update them in place.
+    else if (Indexed(command))
+    {
+        std::shared_lock<std::shared_timed_mutex> guard(Clap::lock);
 
-            return;
-        }
+        Read(command, args, Clap::current->tree.Root(), Clap::current.get());
+    }
 
-        // Validate input.
-        if (Valid(value) && Valid(label))
-        {
-            // Remove `"` from both ends.
-            Strip(label);
+    // Readers only pin the tree they loaded; writers never modify it in place.
+    else if (Reader(command) && Clap::mode == Mode::EBR)
+    {
+        Epoch::Guard guard;
+        const std::shared_ptr<State> state = std::atomic_load(&Clap::current);
 
-            Clap::root = Node::Insert(Clap::root, value, label);
-        }
+        Read(command, args, state->tree.Root(), state.get());
+    }
 
-        // Invalid input; unsuccessful insert!
-        else
-        {
-            Node::PrintFailure();
-        }
+    // Readers hold the version they started on; writers never modify it in place.
+    else if (Reader(command) && Clap::mode == Mode::MVCC)
+    {
+        const Versions::Handle version = Versions::Acquire();
+        const std::shared_ptr<State> state = std::atomic_load(&Clap::current);
+
+        // The filter and cache only serve the version if it's still their tree's latest.
+        Read(command, args, version->root, (state->tree.Root() == version->root) ? state.get() : nullptr);
     }
 
-    else if (command == "remove")
+    // Readers never mutate the tree, so any number may run at once.
+    else if (Reader(command))
     {
-        Node::Value value;
+        std::shared_lock<std::shared_timed_mutex> guard(Clap::lock);
 
-        // Try to access args.
-        try
-        {
-            value = std::stoull(args.at(0));
-        }
+        Read(command, args, Clap::current->tree.Root(), Clap::current.get());
+    }
 
-        // Args couldn't be properly accessed.
-        catch (...)
-        {
-            Node::PrintFailure();
+    // Writers copy the nodes they modify, publish the new root, and retire the originals.
+    else if (Clap::mode == Mode::EBR)
+    {
+        std::unique_lock<std::shared_timed_mutex> guard(Clap::lock);
+        Node::Scope scope;
 
-            return;
-        }
+        Write(command, args);
 
-        // If `value` is not a valid `Value`, the value wouldn't
-        // have been inserted anyway. Thus, it doesn't necessarily
-        // need to be checked.
-        Clap::root = Node::Remove(Clap::root, value);
+        Epoch::Retire(scope.retired);
+        Settle();
     }
 
-    else if (command == "removeInorder")
+    // Writers copy the nodes they modify, and publish the new tree as a version.
+    else if (Clap::mode == Mode::MVCC)
     {
-        unsigned int n;
+        std::unique_lock<std::shared_timed_mutex> guard(Clap::lock);
+        Node::Scope scope;
 
-        // Try to access args.
-        try
-        {
-            n = std::stoi(args.at(0));
-        }
+        Write(command, args);
 
-        // Args couldn't be properly accessed.
-        catch (...)
-        {
-            Node::PrintFailure();
+        Versions::Publish(Clap::current->tree, scope.retired);
+        Settle();
+    }
 
-            return;
-        }
+    // Writers need the tree to themselves.
+    else
+    {
+        std::unique_lock<std::shared_timed_mutex> guard(Clap::lock);
 
-        Clap::root = Node::Remove(Clap::root, n);
+        Write(command, args);
+        Settle();
     }
+}
+
+bool Clap::Reader(const Clap::Command& command)
+{
+    return command == "search"
+        || command == "printPreorder"
+        || command == "printInorder"
+        || command == "printPostorder"
+        || command == "printLevelCount"
+        || command == "save"
+        || command == "asof"
+        || Indexed(command);
+}
+
+bool Clap::Indexed(const Clap::Command& command)
+{
+    return command == "countRange"
+        || command == "rank"
+        || command == "select"
+        || command == "searchPrefix"
+        || command == "searchName"
+        || command == "searchFuzzy"
+        || command == "stats";
+}
 
-    else if (command == "search")
+void Clap::Read(const Clap::Command& command, const Clap::Args& args, const Node* root, Clap::State* state)
+{
+    if (command == "search")
     {
         Arg arg;
 
@@ -249,7 +572,73 @@ void Clap::Execute(const Clap::Command& command, const Clap::Args& args)
                 return;
             }
 
-            Node::Search(Clap::root, value);
+            const std::shared_ptr<const Frozen> frozen = state ? std::atomic_load(&state->frozen) : nullptr;
+
+            // Only readers holding the lock may read the IDs; any reader may read the filter.
+            const bool indexed = !Clap::engine && state && Clap::mode == Mode::RWL;
+            const std::shared_ptr<Bloom> bloom = state ? std::atomic_load(&state->bloom) : nullptr;
+
+            if (Clap::engine)
+            {
+                Clap::engine->Search(value);
+            }
+
+            // Ruled out by the filter; unsuccessful search!
+            else if (bloom && !bloom->Contains(value))
+            {
+                Clap::counters.negatives++;
+
+                Node::PrintFailure();
+            }
+
+            else
+            {
+                bool found = false;
+
+                // Hashed straight to its node.
+                if (indexed && state->table)
+                {
+                    Clap::counters.lookups++;
+
+                    found = state->table->Search(value);
+                }
+
+                // Not an ID of the tree; unsuccessful search!
+                else if (indexed && !state->ids.Contains(value))
+                {
+                    Clap::counters.hits++;
+
+                    Node::PrintFailure();
+                }
+
+                // Hot IDs answered from the cache, the rest from the frozen copy or the tree behind it.
+                else if (state && state->hot)
+                {
+                    Clap::counters.misses += indexed;
+
+                    found = state->hot->Search(state->tree, root, frozen.get(), value);
+                }
+
+                else if (frozen)
+                {
+                    Clap::counters.misses += indexed;
+
+                    found = frozen->Search(value);
+                }
+
+                else
+                {
+                    Clap::counters.misses += indexed;
+
+                    found = Node::Search(root, value);
+                }
+
+                if (bloom)
+                {
+                    Clap::counters.positives++;
+                    Clap::counters.falsePositives += !found;
+                }
+            }
         }
 
         // Arg is a <NAME> argument.
@@ -258,32 +647,1220 @@ void Clap::Execute(const Clap::Command& command, const Clap::Args& args)
             Node::Label label = arg;
             Strip(label);
 
-            Node::Search(Clap::root, label);
-        }
-    }
+            if (Clap::engine)
+            {
+                Clap::engine->Search(label);
+            }
 
-    else if (command == "printPreorder")
-    {
-        Node::Print(Clap::root, Node::Order::NLR);
+            // Scan the columnar copy of the labels instead of walking the tree, once one was built.
+            else if (Clap::mode == Mode::RWL && state && (std::atomic_load(&state->column) || state->walked.exchange(true)))
+            {
+                std::shared_ptr<const Column> column = std::atomic_load(&state->column);
+
+                // The second search since the last write builds it; readers that race to do so build the same one.
+                if (!column)
+                {
+                    column = std::make_shared<const Column>(root);
+
+                    std::atomic_store(&state->column, column);
+                }
+
+                column->Search(label);
+            }
+
+            else
+            {
+                Node::Search(root, label);
+            }
+        }
+    }
+
+    else if (command == "printPreorder")
+    {
+        if (Clap::engine)
+        {
+            Clap::engine->Print(Node::Order::NLR);
+        }
+
+        else
+        {
+            Node::Print(root, Node::Order::NLR);
+        }
     }
 
     else if (command == "printInorder")
     {
-        Node::Print(Clap::root, Node::Order::LNR);
+        if (Clap::engine)
+        {
+            Clap::engine->Print(Node::Order::LNR);
+        }
+
+        else
+        {
+            Node::Print(root, Node::Order::LNR);
+        }
     }
 
     else if (command == "printPostorder")
     {
-        Node::Print(Clap::root, Node::Order::LRN);
+        if (Clap::engine)
+        {
+            Clap::engine->Print(Node::Order::LRN);
+        }
+
+        else
+        {
+            Node::Print(root, Node::Order::LRN);
+        }
     }
 
     else if (command == "printLevelCount")
     {
-        Node::Print(Clap::root);
+        if (Clap::engine)
+        {
+            Clap::engine->Print();
+        }
+
+        else
+        {
+            Node::Print(root);
+        }
     }
 
-    else
+    // The IDs only cover the tree in use, and are read under the lock; see `Indexed`.
+    else if (Indexed(command) && (Clap::engine || !state))
     {
         Node::PrintFailure();
     }
+
+    else if (command == "countRange")
+    {
+        Node::Value lo;
+        Node::Value hi;
+
+        // Try to access and convert args.
+        try
+        {
+            lo = std::stoull(args.at(0));
+            hi = std::stoull(args.at(1));
+        }
+
+        // Args couldn't be properly accessed or converted.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Every ID is at most 8 digits, which also keeps `hi + 1` from overflowing.
+        hi = std::min<Node::Value>(hi, 99999999);
+
+        Clap::counters.hits++;
+
+        Node::Print(std::to_string((lo <= hi) ? state->ids.Rank(hi + 1) - state->ids.Rank(lo) : 0));
+    }
+
+    else if (command == "rank")
+    {
+        Node::Value value;
+
+        // Try to access and convert args.
+        try
+        {
+            value = std::stoull(args.at(0));
+        }
+
+        // Args couldn't be properly accessed or converted.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        Clap::counters.hits++;
+
+        Node::Print(std::to_string(state->ids.Rank(value)));
+    }
+
+    else if (command == "select")
+    {
+        unsigned long long n;
+
+        // Try to access and convert args.
+        try
+        {
+            n = std::stoull(args.at(0));
+        }
+
+        // Args couldn't be properly accessed or converted.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        std::uint32_t value;
+
+        Clap::counters.hits++;
+
+        if (state->ids.Select(n, value))
+        {
+            Node::Print(Node::Pad(value));
+        }
+
+        // Fewer IDs than that; unsuccessful select!
+        else
+        {
+            Node::PrintFailure();
+        }
+    }
+
+    else if (command == "searchPrefix" || command == "searchName")
+    {
+        Node::Label label;
+
+        // Try to access args.
+        try
+        {
+            label = args.at(0);
+        }
+
+        // Args couldn't be properly accessed.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Only a quoted <NAME> argument, and only with the labels indexed.
+        if (!state->names || label.size() < 2 || label.front() != '"' || label.back() != '"')
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Remove `"` from both ends.
+        Strip(label);
+
+        if (command == "searchPrefix")
+        {
+            state->names->Prefix(label);
+        }
+
+        else
+        {
+            state->names->Search(label);
+        }
+    }
+
+    else if (command == "searchFuzzy")
+    {
+        Node::Label label;
+        std::size_t k;
+
+        // Try to access and convert args.
+        try
+        {
+            label = args.at(0);
+            k = std::stoull(args.at(1));
+        }
+
+        // Args couldn't be properly accessed or converted.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Only a quoted <NAME> argument, and only with the trigrams indexed.
+        if (!state->grams || label.size() < 2 || label.front() != '"' || label.back() != '"')
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Remove `"` from both ends.
+        Strip(label);
+
+        state->grams->Search(label, k);
+    }
+
+    else if (command == "stats")
+    {
+        std::string stats = "roaring: " + std::to_string(state->ids.Count()) + " ids, "
+            + std::to_string(state->ids.Bytes()) + " bytes, "
+            + std::to_string(Clap::counters.hits) + " hits, "
+            + std::to_string(Clap::counters.misses) + " misses";
+
+        stats += "\nintern: " + Intern::Stats();
+
+        stats += "\ntree: " + std::to_string(Node::Rotations()) + " rotations";
+
+        const std::shared_ptr<Bloom> bloom = std::atomic_load(&state->bloom);
+
+        if (bloom)
+        {
+            stats += "\nbloom: " + std::to_string(bloom->Bytes()) + " bytes, "
+                + std::to_string(Clap::counters.negatives) + " negatives, "
+                + std::to_string(Clap::counters.positives) + " positives, "
+                + std::to_string(Clap::counters.falsePositives) + " false positives";
+        }
+
+        if (state->table)
+        {
+            stats += "\ntable: " + std::to_string(state->table->Size()) + " ids, "
+                + std::to_string(state->table->Bytes()) + " bytes, "
+                + std::to_string(Clap::counters.lookups) + " lookups";
+        }
+
+        if (state->hot)
+        {
+            stats += "\ncache: " + state->hot->Stats();
+        }
+
+        if (state->names)
+        {
+            stats += "\nnames: " + std::to_string(state->names->Size()) + " ids";
+        }
+
+        if (state->grams)
+        {
+            stats += "\ngrams: " + std::to_string(state->grams->Size()) + " ids, "
+                + std::to_string(state->grams->Count()) + " trigrams, "
+                + std::to_string(state->grams->Bytes()) + " bytes";
+        }
+
+        Node::Print(stats);
+    }
+
+    else if (command == "save")
+    {
+        Arg path;
+
+        // Try to access args.
+        try
+        {
+            path = args.at(0);
+        }
+
+        // Args couldn't be properly accessed.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        std::ofstream stream(path, std::ios::binary);
+
+        // Snapshots only cover the single tree.
+        if (!Clap::engine && stream && Snapshot::Save(root, stream))
+        {
+            Node::PrintSuccess();
+        }
+
+        // File couldn't be written; unsuccessful save!
+        else
+        {
+            Node::PrintFailure();
+        }
+    }
+
+    else if (command == "asof")
+    {
+        unsigned long long sequence;
+        Command query;
+
+        // Try to access and convert args.
+        try
+        {
+            sequence = std::stoull(args.at(0));
+            query = args.at(1);
+        }
+
+        // Args couldn't be properly accessed or converted.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Only versions published in `MVCC` mode are retained.
+        const Versions::Handle version = (!Clap::engine && Clap::mode == Mode::MVCC)
+            ? Versions::At(sequence)
+            : nullptr;
+
+        // Past versions are only searched and printed.
+        if (version && Reader(query) && query != "save" && query != "asof")
+        {
+            Read(query, Args(args.begin() + 2, args.end()), version->root, nullptr);
+        }
+
+        // Version expired or not yet written; unsuccessful command!
+        else
+        {
+            Node::PrintFailure();
+        }
+    }
+}
+
+void Clap::Write(const Clap::Command& command, const Clap::Args& args)
+{
+    // Writes to the tree in use thaw its frozen and columnar copies, which would otherwise go stale.
+    if (command == "insert" || command == "remove" || command == "removeInorder" || command == "commit")
+    {
+        std::atomic_store(&Clap::current->frozen, std::shared_ptr<const Frozen>());
+        std::atomic_store(&Clap::current->column, std::shared_ptr<const Column>());
+        Clap::current->walked = false;
+    }
+
+    // Writes also outdate the working copies of transactions; commits count themselves once published.
+    if (!command.empty() && command != "freeze" && command != "train" && command != "commit")
+    {
+        Clap::writes++;
+    }
+
+    // Base case sanity check.
+    if (command.empty())
+    {
+        // Do nothing...
+    }
+
+    else if (command == "freeze")
+    {
+        // Frozen copies only cover the single tree.
+        if (Clap::engine)
+        {
+            Node::PrintFailure();
+        }
+
+        else
+        {
+            std::atomic_store(&Clap::current->frozen, std::shared_ptr<const Frozen>(new Frozen(Clap::current->tree)));
+
+            // Also forget the IDs removed since the filter was built.
+            Filter(Clap::current->tree.Root());
+
+            Node::PrintSuccess();
+        }
+    }
+
+    else if (command == "train")
+    {
+        // Labels are re-encoded in place, so nothing may read them meanwhile; only readers in `RWL` mode wait.
+        if (Clap::engine || Clap::mode != Mode::RWL)
+        {
+            Node::PrintFailure();
+        }
+
+        else
+        {
+            Intern::Train();
+
+            Node::PrintSuccess();
+        }
+    }
+
+    else if (command == "insert" || command == "remove" || command == "removeInorder")
+    {
+        Mutate(command, args, Clap::current->tree, Clap::current.get());
+
+        // Resize the filter once it's full; the one it replaces already holds every ID of the tree.
+        if (Clap::current->bloom && Clap::current->bloom->Full())
+        {
+            Filter(Clap::current->tree.Root());
+        }
+    }
+
+    else if (command == "commit")
+    {
+        Transaction& transaction = *Clap::transaction;
+
+        // Catch up with the writes committed since the working copy was made.
+        if (transaction.open && transaction.writes != Clap::writes)
+        {
+            Rebase(transaction);
+        }
+
+        // Publish the working copy only if every staged command succeeded, and once it's durable.
+        if (transaction.open && !transaction.failed && !Clap::engine
+            && (transaction.record.empty() || Journal::Append(transaction.record)))
+        {
+            // Every staged command succeeded, so each one changed the IDs as it would have alone.
+            for (const std::string& line : transaction.record)
+            {
+                Command staged;
+                Args arguments;
+
+                Split(line, staged, arguments);
+                Track(staged, arguments);
+            }
+
+            // Resize the filter once it's full, before it's paired with the tree.
+            if (Clap::current->bloom && Clap::current->bloom->Full())
+            {
+                Filter(transaction.root);
+            }
+
+            // Every node the working copy doesn't share is either new, or a copy of one about to be freed.
+            if (Clap::current->table)
+            {
+                for (const Node* node : transaction.fresh)
+                {
+                    Clap::current->table->Insert(node);
+                }
+            }
+
+            Clap::writes++;
+            Clap::current->tree.Exchange(transaction.root);
+
+            // The nodes of the previous tree the working copy replaced.
+            Node::Clear(transaction.retired);
+
+            // The working copy's own nodes now belong to the tree.
+            transaction.fresh.clear();
+
+            Node::PrintSuccess();
+        }
+
+        // No transaction, or one of its commands failed; unsuccessful commit!
+        else
+        {
+            Node::PrintFailure();
+        }
+
+        Discard(transaction);
+    }
+
+    else if (command == "load" || command == "restore")
+    {
+        Arg source;
+
+        // Try to access args.
+        try
+        {
+            source = args.at(0);
+        }
+
+        // Args couldn't be properly accessed.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        std::string snapshot;
+        bool read;
+
+        // Loads read the snapshot from its file; restores carry it along, in hexadecimal.
+        if (command == "load")
+        {
+            std::ifstream file(source, std::ios::binary);
+            snapshot.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+            read = file.good() || file.eof();
+        }
+
+        else
+        {
+            read = Unhex(source, snapshot);
+        }
+
+        std::istringstream stream(snapshot);
+        Tree loaded;
+
+        // Only replace the tree once the whole snapshot decoded.
+        if (!Clap::engine && read && Snapshot::Load(stream, loaded))
+        {
+            // Logged as a restore of what was read, so replaying it never depends on the file.
+            if (!Log({ "restore " + Hex(snapshot) }))
+            {
+                return;
+            }
+
+            // Indexed in full before it's made the one in use, so lock-free readers never pair it with a filter missing its IDs.
+            const std::shared_ptr<State> state = Index(loaded.Release());
+            const std::shared_ptr<State> previous = Clap::current;
+
+            Clap::trees[Clap::tree] = state;
+            std::atomic_store(&Clap::current, state);
+
+            // Cleared by the writer rather than by the tree's last owner, so its scope retires the nodes.
+            previous->tree.Clear();
+
+            Node::PrintSuccess();
+        }
+
+        // File couldn't be read; unsuccessful load!
+        else
+        {
+            Node::PrintFailure();
+        }
+    }
+
+    else if (command == "create" || command == "use" || command == "drop")
+    {
+        Arg name;
+
+        // Try to access args.
+        try
+        {
+            name = args.at(0);
+        }
+
+        // Args couldn't be properly accessed.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Log the mutation ahead of applying it, so replaying the journal rebuilds the trees.
+        if (!Log({ Join(command, args) }))
+        {
+            return;
+        }
+
+        const bool exists = Clap::trees.count(name);
+
+        // Named trees only exist outside of engines.
+        if (Clap::engine)
+        {
+            Node::PrintFailure();
+        }
+
+        else if (command == "create" && !exists)
+        {
+            Clap::trees.emplace(name, Index(nullptr));
+
+            Node::PrintSuccess();
+        }
+
+        // Switching only swaps states, each already indexed; readers still holding the previous one keep a live tree.
+        else if (command == "use" && exists)
+        {
+            std::atomic_store(&Clap::current, Clap::trees[name]);
+
+            Clap::tree = name;
+
+            Node::PrintSuccess();
+        }
+
+        // The tree in use can't be dropped.
+        else if (command == "drop" && exists && name != Clap::tree)
+        {
+            // Cleared by the writer rather than by the tree's last owner, so its scope retires the nodes.
+            Clap::trees[name]->tree.Clear();
+            Clap::trees.erase(name);
+
+            Node::PrintSuccess();
+        }
+
+        // No such tree, or already existing; unsuccessful command!
+        else
+        {
+            Node::PrintFailure();
+        }
+    }
+
+    else if (command == "copy")
+    {
+        Arg from;
+        Arg to;
+
+        // Try to access args.
+        try
+        {
+            from = args.at(0);
+            to = args.at(1);
+        }
+
+        // Args couldn't be properly accessed.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Log the mutation ahead of applying it, so replaying the journal rebuilds the trees.
+        if (!Log({ Join(command, args) }))
+        {
+            return;
+        }
+
+        // The source must exist, and the destination must not.
+        if (!Clap::engine && Clap::trees.count(from) && !Clap::trees.count(to))
+        {
+            Clap::trees.emplace(to, Index(Tree(Clap::trees[from]->tree).Release()));
+
+            Node::PrintSuccess();
+        }
+
+        else
+        {
+            Node::PrintFailure();
+        }
+    }
+
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void Clap::Mutate(const Clap::Command& command, const Clap::Args& args, Tree& tree, Clap::State* state)
+{
+    if (command == "insert")
+    {
+        Node::Value value;
+        Node::Label label;
+
+        // Try to access args.
+        try
+        {
+            value = std::stoull(args.at(1));
+            label = args.at(0);
+        }
+
+        // Args couldn't be properly accessed.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Validate input.
+        if (Valid(value) && Valid(label))
+        {
+            // Log the mutation ahead of applying it, so replaying the journal rebuilds the trees.
+            if (state && !Log({ Join(command, args) }))
+            {
+                return;
+            }
+
+            // Remove `"` from both ends.
+            Strip(label);
+
+            if (Clap::engine)
+            {
+                Clap::engine->Insert(value, label);
+            }
+
+            // Already an ID of the tree; unsuccessful insert!
+            else if (state && state->table && state->table->Contains(value))
+            {
+                Clap::counters.lookups++;
+
+                Node::PrintFailure();
+            }
+
+            else if (state && !state->table && state->ids.Contains(value))
+            {
+                Clap::counters.hits++;
+
+                Node::PrintFailure();
+            }
+
+            else
+            {
+                // Counted by whichever structure ruled out a duplicate.
+                if (state && state->table)
+                {
+                    Clap::counters.lookups++;
+                }
+
+                else if (state)
+                {
+                    Clap::counters.misses++;
+                }
+
+                // Indexed before the tree publishes the new node, so lock-free readers never miss it.
+                if (state)
+                {
+                    Added(*state, static_cast<std::uint32_t>(value), label);
+                }
+
+                const Node* inserted = tree.Insert(value, label);
+
+                // Handed back by the insert, so it isn't searched for again.
+                if (state && state->table)
+                {
+                    state->table->Insert(inserted);
+                }
+            }
+        }
+
+        // Invalid input; unsuccessful insert!
+        else
+        {
+            Node::PrintFailure();
+        }
+    }
+
+    else if (command == "remove")
+    {
+        Node::Value value;
+
+        // Try to access args.
+        try
+        {
+            value = std::stoull(args.at(0));
+        }
+
+        // Args couldn't be properly accessed.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Log the mutation ahead of applying it, so replaying the journal rebuilds the trees.
+        if (state && !Log({ Join(command, args) }))
+        {
+            return;
+        }
+
+        // If `value` is not a valid `Value`, the value wouldn't
+        // have been inserted anyway. Thus, it doesn't necessarily
+        // need to be checked.
+        if (Clap::engine)
+        {
+            Clap::engine->Remove(value);
+        }
+
+        // Not an ID of the tree; unsuccessful remove!
+        else if (state && !state->ids.Contains(value))
+        {
+            Clap::counters.hits++;
+
+            Node::PrintFailure();
+        }
+
+        else
+        {
+            tree.Remove(value);
+
+            if (state)
+            {
+                Clap::counters.misses++;
+
+                Removed(*state, static_cast<std::uint32_t>(value));
+            }
+        }
+    }
+
+    else if (command == "removeInorder")
+    {
+        unsigned int n;
+
+        // Try to access args.
+        try
+        {
+            n = std::stoi(args.at(0));
+        }
+
+        // Args couldn't be properly accessed.
+        catch (...)
+        {
+            Node::PrintFailure();
+
+            return;
+        }
+
+        // Log the mutation ahead of applying it, so replaying the journal rebuilds the trees.
+        if (state && !Log({ Join(command, args) }))
+        {
+            return;
+        }
+
+        std::uint32_t value;
+
+        if (Clap::engine)
+        {
+            Clap::engine->Remove(n);
+        }
+
+        // The IDs tell which one is n-th, so it's removed like any other.
+        else if (state && state->ids.Select(n, value))
+        {
+            Clap::counters.misses++;
+
+            tree.Remove(static_cast<Node::Value>(value));
+
+            Removed(*state, value);
+        }
+
+        // Fewer IDs than that; unsuccessful remove!
+        else if (state)
+        {
+            Clap::counters.hits++;
+
+            Node::PrintFailure();
+        }
+
+        else
+        {
+            tree.Remove(n);
+        }
+    }
+}
+
+void Clap::Stage(const Clap::Command& command, const Clap::Args& args)
+{
+    Transaction& transaction = *Clap::transaction;
+
+    if (command == "begin")
+    {
+        // Transactions don't nest, and only cover the single tree.
+        if (transaction.open || Clap::engine)
+        {
+            Node::PrintFailure();
+        }
+
+        else
+        {
+            transaction.open = true;
+            Rebase(transaction);
+
+            Node::PrintSuccess();
+        }
+    }
+
+    else if (command == "rollback")
+    {
+        if (transaction.open)
+        {
+            Discard(transaction);
+
+            Node::PrintSuccess();
+        }
+
+        // No transaction; unsuccessful rollback!
+        else
+        {
+            Node::PrintFailure();
+        }
+    }
+
+    else
+    {
+        // Catch up with the writes committed since the working copy was made.
+        if (transaction.writes != Clap::writes)
+        {
+            Rebase(transaction);
+        }
+
+        // Reads see the staged commands.
+        if (Reader(command))
+        {
+            Read(command, args, transaction.root, nullptr);
+        }
+
+        // Mutations print nothing until the commit.
+        else if (command == "insert" || command == "remove" || command == "removeInorder")
+        {
+            transaction.record.push_back(Join(command, args));
+
+            Apply(transaction, command, args);
+        }
+
+        // Other writers can't be staged; unsuccessful command!
+        else
+        {
+            Node::PrintFailure();
+        }
+    }
+}
+
+void Clap::Apply(Clap::Transaction& transaction, const Clap::Command& command, const Clap::Args& args)
+{
+    std::ostringstream replies;
+    std::ostream* previous = Node::Redirect(&replies);
+
+    // Resume the working copy's scope, so the tree it shares nodes with is never changed.
+    {
+        Node::Scope scope;
+        scope.fresh.swap(transaction.fresh);
+        scope.retired.swap(transaction.retired);
+
+        // Owned only while the scope copies whatever it would modify; the tree in use still owns the shared nodes.
+        Tree working(transaction.root);
+
+        Mutate(command, args, working);
+
+        transaction.root = working.Release();
+
+        scope.fresh.swap(transaction.fresh);
+        scope.retired.swap(transaction.retired);
+    }
+
+    Node::Redirect(previous);
+
+    // A single failed command fails the whole transaction.
+    if (replies.str() != "successful\n")
+    {
+        transaction.failed = true;
+    }
+}
+
+void Clap::Rebase(Clap::Transaction& transaction)
+{
+    for (Node* node : transaction.fresh)
+    {
+        delete node;
+    }
+
+    transaction.fresh.clear();
+    transaction.retired.clear();
+    transaction.failed = false;
+
+    transaction.writes = Clap::writes;
+    transaction.root = Clap::current->tree.Root();
+
+    // Stage the commands again, now against the tree in use.
+    for (const std::string& line : transaction.record)
+    {
+        Command command;
+        Args args;
+
+        Split(line, command, args);
+        Apply(transaction, command, args);
+    }
+}
+
+void Clap::Discard(Clap::Transaction& transaction)
+{
+    for (Node* node : transaction.fresh)
+    {
+        delete node;
+    }
+
+    transaction.fresh.clear();
+    transaction.retired.clear();
+    transaction.record.clear();
+    transaction.failed = false;
+    transaction.open = false;
+    transaction.root = nullptr;
+}
+
+void Clap::Track(const Clap::Command& command, const Clap::Args& args)
+{
+    if (command == "insert")
+    {
+        Node::Label label = args.at(0);
+        Strip(label);
+
+        Added(*Clap::current, static_cast<std::uint32_t>(std::stoull(args.at(1))), label);
+    }
+
+    else if (command == "remove")
+    {
+        Removed(*Clap::current, static_cast<std::uint32_t>(std::stoull(args.at(0))));
+    }
+
+    else if (command == "removeInorder")
+    {
+        std::uint32_t value;
+
+        if (Clap::current->ids.Select(static_cast<unsigned int>(std::stoi(args.at(0))), value))
+        {
+            Removed(*Clap::current, value);
+        }
+    }
+}
+
+void Clap::Added(Clap::State& state, std::uint32_t value, const Node::Label& label)
+{
+    state.ids.Add(value);
+
+    if (state.bloom)
+    {
+        state.bloom->Add(value);
+    }
+
+    if (state.names)
+    {
+        state.names->Add(label, value);
+    }
+
+    if (state.grams)
+    {
+        state.grams->Add(label, value);
+    }
+}
+
+void Clap::Removed(Clap::State& state, std::uint32_t value)
+{
+    state.ids.Remove(value);
+
+    if (state.table)
+    {
+        state.table->Remove(value);
+    }
+
+    if (state.hot)
+    {
+        state.hot->Forget(value);
+    }
+
+    if (state.names)
+    {
+        state.names->Remove(value);
+    }
+
+    if (state.grams)
+    {
+        state.grams->Remove(value);
+    }
+}
+
+void Clap::Filter(const Node* root)
+{
+    if (Clap::current->bloom)
+    {
+        std::atomic_store(&Clap::current->bloom, std::make_shared<Bloom>(root));
+    }
+}
+
+std::shared_ptr<Clap::State> Clap::Index(Node* root)
+{
+    const std::shared_ptr<State> state = std::make_shared<State>();
+
+    state->tree.Exchange(root);
+    state->ids = Roaring(root);
+
+    if (Clap::options.filter)
+    {
+        state->bloom = std::make_shared<Bloom>(root);
+    }
+
+    if (!Clap::options.index.empty())
+    {
+        state->table.reset(new Table(Clap::options.index == "compact"));
+        state->table->Rebuild(root);
+    }
+
+    if (Clap::options.cache)
+    {
+        state->hot.reset(new Hot(Clap::options.cache));
+    }
+
+    if (Clap::options.names)
+    {
+        state->names.reset(new Names());
+        state->names->Rebuild(root);
+    }
+
+    if (Clap::options.fuzzy)
+    {
+        state->grams.reset(new Grams());
+        state->grams->Rebuild(root);
+    }
+
+    return state;
+}
+
+void Clap::Settle()
+{
+    // Only now that readers load the new tree, so none caches a removed ID again from the previous one.
+    if (Clap::current->hot)
+    {
+        Clap::current->hot->Flush();
+    }
+}
+
+std::string Clap::Join(const Clap::Command& command, const Clap::Args& args)
+{
+    std::string line = command;
+
+    for (const Arg& arg : args)
+    {
+        line += " " + arg;
+    }
+
+    return line;
+}
+
+bool Clap::Log(const Journal::Record& record)
+{
+    // Not durable; unsuccessful command!
+    if (!Journal::Append(record))
+    {
+        Node::PrintFailure();
+
+        return false;
+    }
+
+    return true;
+}
+
+std::string Clap::Hex(const std::string& bytes)
+{
+    static const char digits[] = "0123456789abcdef";
+
+    std::string hex;
+    hex.reserve(2 * bytes.size());
+
+    for (const char byte : bytes)
+    {
+        hex.push_back(digits[static_cast<unsigned char>(byte) >> 4]);
+        hex.push_back(digits[static_cast<unsigned char>(byte) & 0xF]);
+    }
+
+    return hex;
+}
+
+bool Clap::Unhex(const std::string& hex, std::string& bytes)
+{
+    // The value of a digit, or -1 if it isn't one.
+    const auto digit = [](char letter)
+    {
+        if (letter >= '0' && letter <= '9')
+        {
+            return letter - '0';
+        }
+
+        else if (letter >= 'a' && letter <= 'f')
+        {
+            return letter - 'a' + 10;
+        }
+
+        return -1;
+    };
+
+    if (hex.size() % 2)
+    {
+        return false;
+    }
+
+    bytes.clear();
+    bytes.reserve(hex.size() / 2);
+
+    for (std::size_t i = 0; i < hex.size(); i += 2)
+    {
+        const int high = digit(hex[i]);
+        const int low = digit(hex[i + 1]);
+
+        if (high < 0 || low < 0)
+        {
+            return false;
+        }
+
+        bytes.push_back(static_cast<char>(high << 4 | low));
+    }
+
+    return true;
 }
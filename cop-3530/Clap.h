@@ -6,11 +6,27 @@
 #define PROJECT_1_CLAP_H
 
 // std...
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <string>
 
 // custom...
+#include "Bloom.h"
+#include "Column.h"
+#include "Engine.h"
+#include "Frozen.h"
+#include "Grams.h"
+#include "Hot.h"
+#include "Journal.h"
+#include "Names.h"
 #include "Node.h"
+#include "Roaring.h"
+#include "Table.h"
+#include "Tree.h"
 
 /**
  * @class Clap
@@ -24,7 +40,97 @@
  * The class also provides typedefs for Command, Arg, and Args, which represent a command string,
  * an argument string, and a vector of argument strings, respectively.
  * 
- * The class also stores a static root node pointer for the AVL tree.
+ * The class also stores the named AVL trees, each a `Tree` owning its nodes, and which one is in use.
+ *
+ * Every command is classified as either a reader or a writer. Readers never mutate the tree and
+ * run concurrently under a shared lock, while writers take the lock exclusively.
+ *
+ * Launched with `--mode ebr`, readers take no lock at all: writers copy every node they would
+ * modify, publish the new root atomically, and retire the replaced nodes through `Epoch`.
+ *
+ * Launched with `--mode mvcc`, writers copy likewise but publish each tree as a version through
+ * `Versions`; readers hold a handle to the version they started on, which is freed by reference
+ * counting once released, so a long traversal sees one point in time however much is written meanwhile.
+ * The latest `--retain <n>` past versions (64 by default) are also kept, so long as their nodes fit
+ * in `--budget <bytes>` (64 MiB by default): `asof <seq> search <ID>` and `asof <seq> printInorder`,
+ * or any other search or print, read the tree as it was after the first `seq` writer commands.
+ *
+ * Any number of named trees may be kept at once: `create <name>` makes an empty tree, `copy <from> <to>`
+ * makes a copy of one, `use <name>` switches the tree the other commands act on, and `drop <name>` destroys
+ * a tree other than the one in use. The process starts with a single tree named `default`. Each tree
+ * keeps its IDs, and every index, cache, and copy of it below, alongside it, so `use` only switches
+ * which one is in use, and `load` replaces the tree in use along with all of them.
+ *
+ * `freeze` builds a `Frozen` copy of the tree in use, which then serves `search <ID>` until the
+ * next write to the tree thaws it by discarding the copy; the tree itself is kept throughout.
+ *
+ * In `RWL` mode, the second `search <NAME>` since the last write builds a `Column` of the labels of
+ * the tree in use, in ID order, and scans it; the next ones scan the same one, until a write to the
+ * tree drops it. Lock-free readers of other modes can't tell which tree a column was built from,
+ * so they walk the tree instead.
+ *
+ * `train` trains a table of `Symbols` on the labels interned so far, typically right after `load`,
+ * and compresses every label, those interned later included, against it. Only supported in `RWL`
+ * mode, as the labels are re-encoded in place; readers of other modes never wait for writers.
+ *
+ * `begin` opens a transaction: the inserts and removes that follow are staged against a private
+ * working copy of the tree in use, sharing every node they don't modify, and print nothing; reads
+ * see them. `commit` then publishes the working copy at once, printing a single result, but only if
+ * every staged command succeeded; `rollback` discards it. If other writers commit first, the staged
+ * commands are applied again on top of their tree. Each connection has its own transaction.
+ *
+ * A `Roaring` bitmap of the IDs of each tree is kept alongside it, so `insert` rejects duplicates,
+ * and `remove` and `removeInorder` reject missing IDs, without descending the tree; `removeInorder`
+ * also selects its ID from the bitmap rather than walking the tree. The bitmap also answers
+ * `countRange <lo> <hi>` (the number of IDs between the two, inclusive), `rank <ID>` (the number
+ * of IDs below it), and `select <n>` (the n-th ID in order). Searches for missing IDs are rejected
+ * too, but only in `RWL` mode, as lock-free readers can't read the bitmap while writers update it.
+ * `stats` prints the bitmap's size, along with how many commands it answered alone (hits) and how
+ * many it passed on to the tree (misses), and the size of the pool of interned labels. These
+ * commands are unsupported within transactions.
+ *
+ * Launched with `--balance wavl`, every tree is balanced as a weak AVL tree rather than a strict
+ * one, so a removal does at most two rotations; see `Node`. `stats` prints how many rotations every
+ * insertion and removal did so far, under either policy.
+ *
+ * Launched with `--filter`, a `Bloom` filter of the IDs of the tree in use is also kept, which
+ * readers in every mode consult before searching; an ID it rules out is never searched for. It's
+ * rebuilt on `freeze`, and whenever it's full. `stats` then also
+ * prints how many searches it ruled out (negatives), how many it let through (positives), and how
+ * many of those found nothing (false positives).
+ *
+ * Launched with `--index fast|compact` in `RWL` mode, a `Table` from each ID of the tree in use to
+ * its node is also kept, which answers `search <ID>` and the duplicate checks of `insert` in a few
+ * probes instead of a descent; `compact` trades some of that speed for half the memory. It's only
+ * repointed at the nodes a commit replaced.
+ * `stats` then also prints its size, and how many searches and duplicate checks it answered (lookups),
+ * which the bitmap then no longer counts. Other modes copy nodes on write, so they're never indexed.
+ *
+ * Launched with `--cache <n>`, a `Hot` cache of the labels of at least n of the most searched IDs of
+ * the tree in use sits in front of it, in every mode; the IDs a write removes are dropped from it
+ * once the write is published. `stats` then
+ * also prints how many searches it answered (hits), how many it passed on (misses), and how many IDs
+ * found behind it weren't searched often enough to replace a cached one (rejected).
+ *
+ * Launched with `--names`, a `Names` index of the labels of the tree in use is also kept, in every
+ * mode, which answers `searchPrefix "<prefix>"` (the IDs whose name starts with the prefix, ordered
+ * by name) and `searchName "<NAME>"` (the IDs whose name equals it, in order), both ignoring case,
+ * without walking the tree. Like the bitmap,
+ * it's read under the lock in every mode, and neither command is supported within transactions.
+ * `stats` then also prints its size.
+ *
+ * Launched with `--fuzzy`, a `Grams` index of the trigrams of the labels of the tree in use is
+ * also kept, likewise, which answers `searchFuzzy "<NAME>" <k>`: the k IDs whose name is the fewest
+ * edits away from it, ignoring case, closest first, among the names sharing some of its trigrams.
+ * `stats` then also prints its size.
+ *
+ * Launched with `--journal <path>`, every mutation whose arguments are accepted, and every commit as a
+ * whole, is made durable as a single `Journal` record before it takes effect; the journal is replayed
+ * on the next launch. A `load` is logged as `restore <snapshot>`, with the snapshot it read in
+ * hexadecimal, so replaying it never depends on the file.
+ *
+ * Launched with `--shards <n>` or `--engine art|bplus`, the commands instead run against a `Shards`,
+ * `Radix`, or `BPlus` engine, which synchronizes itself; `save`, `load`, and transactions are unsupported there.
  */
 class Clap
 {
@@ -39,13 +145,31 @@ public:
      * 
      * This method reads the number of commands from the standard input, 
      * then reads each command and executes it.
+     *
+     * If launched as `--serve <path>`, the commands are instead read from the clients of a
+     * Unix domain socket bound at `path`, and the tree lives for as long as the server does.
+     * The clients are served by `--threads <n>` threads, defaulting to one per core.
+     *
+     * @param argc The number of command line arguments.
+     * @param argv The command line arguments.
+     *
+     * @return The exit status of the program.
      * 
      * Time complexity: O(n) where n is the number of commands.
      */
-    static void Run();
+    static int Run(int argc, char** argv);
 
 private:
 
+    //
+    // Friends
+    //
+
+    /**
+     * @brief The server parses and executes its clients' commands directly.
+     */
+    friend class Server;
+
     //
     // Typedefs
     //
@@ -71,6 +195,211 @@ private:
      */
     using Args = std::vector<Arg>;
 
+    /**
+     * @enum Mode
+     * @brief Represents how reader commands are kept safe from writer commands.
+     */
+    enum Mode
+    {
+        /**
+         * @brief Reader-Writer Locking (readers share the lock, writers mutate in place)
+         */
+        RWL,
+
+        /**
+         * @brief Epoch-Based Reclamation (readers take no lock, writers copy-on-write)
+         */
+        EBR,
+
+        /**
+         * @brief Multi-Version Concurrency Control (readers hold a version, writers copy-on-write)
+         */
+        MVCC,
+    };
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Options
+     * @brief Represents the indexes and caches every tree is launched with.
+     */
+    struct Options
+    {
+        /**
+         * @brief Whether each tree is filtered, if launched with `--filter`.
+         */
+        bool filter = false;
+
+        /**
+         * @brief The layout of the table of each tree, if launched with `--index`; empty otherwise.
+         */
+        std::string index;
+
+        /**
+         * @brief The capacity of the cache in front of each tree, if launched with `--cache`; zero otherwise.
+         */
+        std::size_t cache = 0;
+
+        /**
+         * @brief Whether the labels of each tree are indexed, if launched with `--names`.
+         */
+        bool names = false;
+
+        /**
+         * @brief Whether the trigrams of the labels of each tree are indexed, if launched with `--fuzzy`.
+         */
+        bool fuzzy = false;
+    };
+
+    /**
+     * @struct Counters
+     * @brief Represents what the IDs, filters, and tables of every tree answered, for `stats`.
+     */
+    struct Counters
+    {
+        /**
+         * @brief The number of commands the IDs answered alone.
+         */
+        std::atomic<unsigned long long> hits { 0 };
+
+        /**
+         * @brief The number of commands the IDs passed on to the tree.
+         */
+        std::atomic<unsigned long long> misses { 0 };
+
+        /**
+         * @brief The number of searches the filters ruled out.
+         */
+        std::atomic<unsigned long long> negatives { 0 };
+
+        /**
+         * @brief The number of searches the filters let through.
+         */
+        std::atomic<unsigned long long> positives { 0 };
+
+        /**
+         * @brief The number of searches the filters let through that found nothing.
+         */
+        std::atomic<unsigned long long> falsePositives { 0 };
+
+        /**
+         * @brief The number of searches and duplicate checks the tables answered, if launched with
+         * `--index`; the IDs count none of those.
+         */
+        std::atomic<unsigned long long> lookups { 0 };
+    };
+
+    /**
+     * @struct State
+     * @brief Represents a named tree, along with its IDs and every index and cache kept of it, so
+     * switching trees only switches states.
+     */
+    struct State
+    {
+        /**
+         * @brief The tree.
+         */
+        Tree tree;
+
+        /**
+         * @brief The IDs of the tree.
+         */
+        Roaring ids;
+
+        /**
+         * @brief The filter of the IDs of the tree, if launched with `--filter`. Replaced atomically, so
+         * lock-free readers may keep using one a writer has since discarded; writers may read it directly.
+         */
+        std::shared_ptr<Bloom> bloom;
+
+        /**
+         * @brief The table from the IDs of the tree to its nodes, if launched with `--index`.
+         */
+        std::unique_ptr<Table> table;
+
+        /**
+         * @brief The cache of the labels of the hottest IDs of the tree, if launched with `--cache`.
+         */
+        std::unique_ptr<Hot> hot;
+
+        /**
+         * @brief The index of the labels of the tree, if launched with `--names`.
+         */
+        std::unique_ptr<Names> names;
+
+        /**
+         * @brief The index of the trigrams of the labels of the tree, if launched with `--fuzzy`.
+         */
+        std::unique_ptr<Grams> grams;
+
+        /**
+         * @brief The frozen copy of the tree, if any. Always accessed atomically, so lock-free readers
+         * may keep using a copy a writer has since discarded.
+         */
+        std::shared_ptr<const Frozen> frozen;
+
+        /**
+         * @brief The columnar copy of the labels of the tree, if built since the last write. Always
+         * accessed atomically, as readers build it.
+         */
+        std::shared_ptr<const Column> column;
+
+        /**
+         * @brief Whether a search by label walked the tree since the last write, rather than building
+         * `column`; a single search between writes is cheaper to answer by walking.
+         */
+        std::atomic<bool> walked { false };
+    };
+
+    /**
+     * @struct Transaction
+     * @brief Represents the commands staged between `begin` and `commit`, and their working copy.
+     */
+    struct Transaction
+    {
+        /**
+         * @brief Discards the working copy.
+         */
+        ~Transaction();
+
+        /**
+         * @brief Whether a transaction was begun, and not yet committed or rolled back.
+         */
+        bool open = false;
+
+        /**
+         * @brief Whether a staged command failed, dooming the commit.
+         */
+        bool failed = false;
+
+        /**
+         * @brief The root of the working copy.
+         */
+        Node* root = nullptr;
+
+        /**
+         * @brief The number of writes done when the working copy was made; it's outdated by any more.
+         */
+        unsigned long long writes = 0;
+
+        /**
+         * @brief The nodes of the working copy not shared with the tree in use.
+         */
+        std::unordered_set<Node*> fresh;
+
+        /**
+         * @brief The nodes of the tree in use the working copy replaced.
+         */
+        std::vector<Node*> retired;
+
+        /**
+         * @brief The staged command lines, in order.
+         */
+        Journal::Record record;
+    };
+
     //
     // Static Methods
     //
@@ -130,8 +459,22 @@ private:
      */
     static void Parse(unsigned int n);
 
+    /**
+     * @brief Splits the given line into a command and its arguments. Double-quoted
+     * arguments containing spaces are kept together as a single argument.
+     *
+     * @param line The line to be split.
+     * @param command Set to the command of the line.
+     * @param args Set to the arguments of the line.
+     *
+     * Time complexity: O(n) where n is the length of the line.
+     */
+    static void Split(const std::string& line, Command& command, Args& args);
+
     /**
      * @brief Executes the given command with the given arguments in the Command Line Argument Parser (C.L.A.P.).
+     * Reader commands hold the lock shared (or only an epoch guard in `EBR` mode, or a version
+     * handle in `MVCC` mode), writer commands hold it exclusively.
      * 
      * @param command The command to be executed.
      * @param args The arguments to be passed to the command.
@@ -140,16 +483,283 @@ private:
      */
     static void Execute(const Command& command, const Args& args);
 
+    /**
+     * @brief Checks if the given command is a reader, meaning it never mutates the tree.
+     *
+     * @param command The command to be checked.
+     *
+     * @return `true` if the command only reads the tree, `false` otherwise.
+     *
+     * Time complexity: O(1)
+     */
+    static bool Reader(const Command& command);
+
+    /**
+     * @brief Checks if the given command is answered by the IDs of the tree in use alone, which only
+     * readers holding the lock may read.
+     *
+     * @param command The command to be checked.
+     *
+     * @return `true` if the command reads the IDs, `false` otherwise.
+     *
+     * Time complexity: O(1)
+     */
+    static bool Indexed(const Command& command);
+
+    /**
+     * @brief Executes the given reader command against the tree rooted at the given node.
+     * The caller must keep the tree from being mutated for the duration.
+     *
+     * @param command The reader command to be executed.
+     * @param args The arguments to be passed to the command.
+     * @param root The root of the tree to be read.
+     * @param state The state `root` was loaded from, so its filter, cache, and copies may serve the
+     * command, or `nullptr` if it's a past version or a working copy.
+     *
+     * Time complexity: Varies depending on the command.
+     */
+    static void Read(const Command& command, const Args& args, const Node* root, State* state);
+
+    /**
+     * @brief Executes the given writer command. Unknown commands are treated as writers,
+     * and print "unsuccessful". The caller must hold the lock exclusively.
+     *
+     * @param command The writer command to be executed.
+     * @param args The arguments to be passed to the command.
+     *
+     * Time complexity: Varies depending on the command.
+     */
+    static void Write(const Command& command, const Args& args);
+
+    /**
+     * @brief Executes the given insert, remove, or removeInorder command against the given tree.
+     * Defers to the engine, if any.
+     *
+     * @param command The mutating command to be executed.
+     * @param args The arguments to be passed to the command.
+     * @param tree The tree to be mutated.
+     * @param state The state of `tree`, if it's the tree in use, so its IDs are consulted first and kept up to date,
+     * and the command is logged to the journal once its arguments are accepted.
+     *
+     * Time complexity: Varies depending on the command.
+     */
+    static void Mutate(const Command& command, const Args& args, Tree& tree, State* state = nullptr);
+
+    /**
+     * @brief Executes `begin`, `rollback`, or any command within the calling connection's open
+     * transaction. The caller must hold the lock shared.
+     *
+     * @param command The command to be executed.
+     * @param args The arguments to be passed to the command.
+     *
+     * Time complexity: Varies depending on the command.
+     */
+    static void Stage(const Command& command, const Args& args);
+
+    /**
+     * @brief Executes the given mutating command against the transaction's working copy, without
+     * printing. Marks the transaction failed if the command fails.
+     *
+     * @param transaction The transaction.
+     * @param command The mutating command to be executed.
+     * @param args The arguments to be passed to the command.
+     *
+     * Time complexity: Varies depending on the command.
+     */
+    static void Apply(Transaction& transaction, const Command& command, const Args& args);
+
+    /**
+     * @brief Remakes the transaction's working copy from the tree in use, applying its staged commands
+     * again. The caller must keep the tree in use from being mutated for the duration.
+     *
+     * @param transaction The transaction.
+     *
+     * Time complexity: O(m * log n) where m is the number of staged commands and n the number of nodes.
+     */
+    static void Rebase(Transaction& transaction);
+
+    /**
+     * @brief Closes the transaction, discarding its working copy and staged commands.
+     *
+     * @param transaction The transaction.
+     *
+     * Time complexity: O(m) where m is the number of nodes of the working copy not shared.
+     */
+    static void Discard(Transaction& transaction);
+
+    /**
+     * @brief Brings the IDs, and every index and cache, of the tree in use up to date with the given
+     * mutating command, known to have succeeded, as when a transaction's staged commands are committed.
+     * See `Added` and `Removed`.
+     *
+     * @param command The mutating command.
+     * @param args The arguments passed to the command.
+     *
+     * Time complexity: O(c + a) where c and a are as in `Roaring::Add`.
+     */
+    static void Track(const Command& command, const Args& args);
+
+    /**
+     * @brief Brings the IDs, and every index of the given state, up to date with the given ID being
+     * added. Writers call it before the tree publishes the new node, so lock-free readers never pair
+     * the tree with a filter missing the ID; the table, which holds the node itself, is left to them.
+     *
+     * @param state The state of the tree the ID is added to.
+     * @param value The ID.
+     * @param label The label of the ID.
+     *
+     * Time complexity: O(c + a + k) where c and a are as in `Roaring::Add`, and k is the length of `label`.
+     */
+    static void Added(State& state, std::uint32_t value, const Node::Label& label);
+
+    /**
+     * @brief Brings the IDs, and every index and cache of the given state, up to date with the given
+     * ID being removed.
+     *
+     * @param state The state of the tree the ID is removed from.
+     * @param value The ID.
+     *
+     * Time complexity: O(c + a + k) where c and a are as in `Roaring::Add`, and k is the length of the ID's label.
+     */
+    static void Removed(State& state, std::uint32_t value);
+
+    /**
+     * @brief Replaces the filter of the tree in use, if any, with one built from the tree rooted at the
+     * given node. A tree replacing the one in use must be published after, not before, so lock-free
+     * readers never pair it with a filter missing its IDs.
+     *
+     * @param root The root of the tree to be filtered.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    static void Filter(const Node* root);
+
+    /**
+     * @brief Makes the state of a tree owning the nodes of the tree rooted at the given node, building
+     * its IDs and every index and cache of `options`.
+     *
+     * @param root The root of the nodes to be owned.
+     *
+     * @return The state.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    static std::shared_ptr<State> Index(Node* root);
+
+    /**
+     * @brief Drops the IDs the last write removed from the cache, if any. Writers must call it only
+     * once the tree they wrote is the one readers load.
+     *
+     * Time complexity: O(r) where r is the number of IDs removed.
+     */
+    static void Settle();
+
+    /**
+     * @brief Joins the given command and its arguments back into a line, as `Split` reads it.
+     *
+     * @param command The command.
+     * @param args The arguments.
+     *
+     * @return The line.
+     *
+     * Time complexity: O(n) where n is the length of the line.
+     */
+    static std::string Join(const Command& command, const Args& args);
+
+    /**
+     * @brief Logs the given record to the journal, if any, ahead of applying it. Writers call it only
+     * once the arguments of their command are accepted. If it couldn't be made durable, "unsuccessful"
+     * is printed, and the command mustn't take effect.
+     *
+     * @param record The command lines to be logged.
+     *
+     * @return `true` if logged, `false` otherwise.
+     *
+     * Time complexity: O(n) where n is the size of the record, plus one flush.
+     */
+    static bool Log(const Journal::Record& record);
+
+    /**
+     * @brief Encodes the given bytes in hexadecimal, two digits per byte.
+     *
+     * Time complexity: O(n) where n is the number of bytes.
+     */
+    static std::string Hex(const std::string& bytes);
+
+    /**
+     * @brief Decodes the given hexadecimal digits into bytes.
+     *
+     * @param hex The digits, two per byte.
+     * @param bytes Set to the bytes, if decoded.
+     *
+     * @return `true` if decoded, `false` if the digits aren't hexadecimal pairs.
+     *
+     * Time complexity: O(n) where n is the number of digits.
+     */
+    static bool Unhex(const std::string& hex, std::string& bytes);
+
     //
     // Properties
     //
 
     /**
-     * @brief Represents the root node of the AVL tree used in the Command Line Argument Parser (C.L.A.P.).
+     * @brief Represents the indexes and caches every tree is launched with.
+     */
+    static Options options;
+
+    /**
+     * @brief Represents the states of the named trees, by name, the one in use included.
+     */
+    static std::unordered_map<std::string, std::shared_ptr<State>> trees;
+
+    /**
+     * @brief Represents the state of the tree in use, one of `trees`, used in the Command Line Argument Parser (C.L.A.P.).
      *
-     * The root is of type Node.
+     * Always accessed atomically, so lock-free readers may keep using a tree a writer has since switched
+     * away from; writers may read it directly.
+     */
+    static std::shared_ptr<State> current;
+
+    /**
+     * @brief Represents the name of the tree in use.
+     */
+    static std::string tree;
+
+    /**
+     * @brief Represents what the IDs, filters, and tables answered, across every tree.
+     */
+    static Counters counters;
+
+    /**
+     * @brief Represents how reader commands are kept safe from writer commands.
+     */
+    static Mode mode;
+
+    /**
+     * @brief Guards the tree: held shared by reader commands and exclusively by writer commands.
+     */
+    static std::shared_timed_mutex lock;
+
+    /**
+     * @brief Represents the number of writer commands done, outdating the working copies made before.
+     */
+    static std::atomic<unsigned long long> writes;
+
+    /**
+     * @brief Represents the transaction of the standard input.
+     */
+    static Transaction console;
+
+    /**
+     * @brief Represents the transaction of the connection the calling thread executes commands for.
+     * Defaults to `console`.
+     */
+    static thread_local Transaction* transaction;
+
+    /**
+     * @brief Represents the engine commands run against in place of the tree, if any.
      */
-    static Node* root;
+    static Engine* engine;
 };
 
 #endif //PROJECT_1_CLAP_H
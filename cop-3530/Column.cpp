@@ -0,0 +1,171 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// sys...
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// custom...
+#include "Column.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Column::Column(const Node* root)
+{
+    Fill(root);
+}
+
+//
+// Methods
+//
+
+void Column::Search(const Node::Label& label) const
+{
+    Intern::Handle handle;
+
+    // Never interned; no value has it.
+    if (!Intern::Find(label, handle))
+    {
+        Node::PrintFailure();
+
+        return;
+    }
+
+    std::vector<std::size_t> hits;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    // Checked once; every x86-64 processor has SSE2, but not every one AVX2.
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+
+    if (avx2)
+    {
+        Wide(this->labels.data(), this->labels.size(), handle, hits);
+    }
+
+    else
+    {
+        Narrow(this->labels.data(), 0, this->labels.size(), handle, hits);
+    }
+#else
+    Narrow(this->labels.data(), 0, this->labels.size(), handle, hits);
+#endif
+
+    std::string result;
+
+    for (const std::size_t i : hits)
+    {
+        result.append(Node::Pad(this->values[i]));
+        result.append("\n");
+    }
+
+    if (!result.empty())
+    {
+        // Print, but remove the last newline insertion.
+        Node::Print(result.substr(0, result.size() - 1));
+    }
+
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Static Methods
+//
+
+#if defined(__GNUC__) && defined(__x86_64__)
+__attribute__((target("avx2")))
+void Column::Wide(const Intern::Handle* labels, std::size_t size, Intern::Handle handle, std::vector<std::size_t>& output)
+{
+    const __m256i needle = _mm256_set1_epi32(static_cast<int>(handle));
+    std::size_t i = 0;
+
+    // Eight handles at a time; a bit per matching handle.
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(labels + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+
+        while (mask)
+        {
+            output.push_back(i + static_cast<std::size_t>(__builtin_ctz(static_cast<unsigned int>(mask))));
+            mask &= mask - 1;
+        }
+    }
+
+    // Fewer than eight left.
+    Narrow(labels, i, size, handle, output);
+}
+#else
+void Column::Wide(const Intern::Handle* labels, std::size_t size, Intern::Handle handle, std::vector<std::size_t>& output)
+{
+    Narrow(labels, 0, size, handle, output);
+}
+#endif
+
+void Column::Narrow(const Intern::Handle* labels, std::size_t first, std::size_t size, Intern::Handle handle, std::vector<std::size_t>& output)
+{
+    std::size_t i = first;
+
+#ifdef __SSE2__
+    const __m128i needle = _mm_set1_epi32(static_cast<int>(handle));
+
+    // Four handles at a time; a bit per matching handle.
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(labels + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+
+        while (mask)
+        {
+            output.push_back(i + static_cast<std::size_t>(__builtin_ctz(static_cast<unsigned int>(mask))));
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    for (; i < size; i++)
+    {
+        if (labels[i] == handle)
+        {
+            output.push_back(i);
+        }
+    }
+}
+
+//
+// Methods
+//
+
+void Column::Fill(const Node* root)
+{
+    // Base case.
+    if (!root)
+    {
+        return;
+    }
+
+    Fill(root->nodeL);
+
+    this->values.push_back(static_cast<std::uint32_t>(root->value));
+    this->labels.push_back(root->label);
+
+    Fill(root->nodeR);
+}
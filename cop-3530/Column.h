@@ -0,0 +1,105 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_COLUMN_H
+#define PROJECT_1_COLUMN_H
+
+// std...
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// custom...
+#include "Intern.h"
+#include "Node.h"
+
+/**
+ * @class Column
+ *
+ * @brief Represents an immutable, columnar copy of the labels of a tree, so searching by label is a
+ * sequential pass over an array rather than a walk of the tree.
+ *
+ * The handles of the interned labels are stored in ID order, in one array, and the values in another.
+ * As equal labels have equal handles, a search compares the handle of the label searched for against
+ * 8 handles at a time with AVX2, or 4 with SSE2 on processors without it, and only reads the values
+ * of the matches; no label is ever compared as a string.
+ */
+class Column
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs a columnar copy of the tree rooted at the given node.
+     *
+     * @param root The root of the tree to be copied.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    explicit Column(const Node* root);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Searches for the given label. If found, the values with that label are printed in order,
+     * left-padded with zeroes. Otherwise, "unsuccessful" is printed. See `Node::Search`.
+     *
+     * Time complexity: O(n) where n is the number of values, compared 8 at a time.
+     */
+    void Search(const Node::Label& label) const;
+
+private:
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Appends the indices of the given handles that equal the given handle to the given output,
+     * in order, using AVX2.
+     *
+     * Time complexity: O(n) where n is the number of handles.
+     */
+    static void Wide(const Intern::Handle* labels, std::size_t size, Intern::Handle handle, std::vector<std::size_t>& output);
+
+    /**
+     * @brief Appends the indices, from `first` up to `size`, of the given handles that equal the given
+     * handle to the given output, in order, using SSE2 where available.
+     *
+     * Time complexity: O(n) where n is the number of handles.
+     */
+    static void Narrow(const Intern::Handle* labels, std::size_t first, std::size_t size, Intern::Handle handle, std::vector<std::size_t>& output);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Appends the values and labels of the tree rooted at the given node, in order.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    void Fill(const Node* root);
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the values, in order.
+     */
+    std::vector<std::uint32_t> values;
+
+    /**
+     * @brief Represents the labels of `values`, in the same order.
+     */
+    std::vector<Intern::Handle> labels;
+};
+
+#endif //PROJECT_1_COLUMN_H
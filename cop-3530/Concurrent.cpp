@@ -0,0 +1,1147 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <thread>
+
+// custom...
+#include "Concurrent.h"
+#include "Epoch.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Concurrent::Concurrent() : holder(0, nullptr, nullptr)
+{
+}
+
+Concurrent::~Concurrent()
+{
+    std::vector<Entry*> entries;
+
+    if (Entry* root = holder.nodeR.load())
+    {
+        entries.push_back(root);
+    }
+
+    // Free every entry still linked.
+    while (!entries.empty())
+    {
+        Entry* entry = entries.back();
+        entries.pop_back();
+
+        if (Entry* nodeL = entry->nodeL.load())
+        {
+            entries.push_back(nodeL);
+        }
+
+        if (Entry* nodeR = entry->nodeR.load())
+        {
+            entries.push_back(nodeR);
+        }
+
+        delete entry->label.load();
+        delete entry;
+    }
+
+    // Free everything unlinked or removed but not yet retired; `Epoch` frees the rest.
+    for (Entry* entry : retiredEntries)
+    {
+        delete entry;
+    }
+
+    for (const Node::Label* label : retiredLabels)
+    {
+        delete label;
+    }
+}
+
+//
+// Methods
+//
+
+bool Concurrent::Insert(const Node::Value& value, const Node::Label& label)
+{
+    Epoch::Guard guard;
+
+    const Node::Label* fresh = new Node::Label(label);
+
+    while (true)
+    {
+        Entry* root = holder.nodeR.load();
+
+        // Empty tree; attach the first entry to the holder.
+        if (!root)
+        {
+            std::lock_guard<std::mutex> guard(holder.lock);
+
+            if (!holder.nodeR.load())
+            {
+                holder.nodeR.store(new Entry(value, fresh, &holder));
+
+                return true;
+            }
+
+            continue;
+        }
+
+        Result result = RETRY;
+
+        if (root->value == value)
+        {
+            result = Update(root, fresh);
+        }
+
+        else
+        {
+            const unsigned long long version = root->version.load();
+
+            if (Shrinking(version))
+            {
+                Wait(root);
+            }
+
+            else if (root == holder.nodeR.load())
+            {
+                result = Insert(value, fresh, root, value > root->value, version);
+            }
+        }
+
+        if (result != RETRY)
+        {
+            // Values must be unique; the label wasn't consumed.
+            if (result == MISSING)
+            {
+                delete fresh;
+            }
+
+            return result == FOUND;
+        }
+    }
+}
+
+bool Concurrent::Remove(const Node::Value& value)
+{
+    // Retired before guarding, so this thread doesn't hold back its own batch.
+    Reclaim();
+
+    Epoch::Guard guard;
+
+    while (true)
+    {
+        Entry* root = holder.nodeR.load();
+
+        // Empty tree.
+        if (!root)
+        {
+            return false;
+        }
+
+        Result result = RETRY;
+
+        if (root->value == value)
+        {
+            result = Remove(&holder, root);
+        }
+
+        else
+        {
+            const unsigned long long version = root->version.load();
+
+            if (Shrinking(version))
+            {
+                Wait(root);
+            }
+
+            else if (root == holder.nodeR.load())
+            {
+                result = Remove(value, root, value > root->value, version);
+            }
+        }
+
+        if (result != RETRY)
+        {
+            return result == FOUND;
+        }
+    }
+}
+
+bool Concurrent::Search(const Node::Value& value, Node::Label& label) const
+{
+    Epoch::Guard guard;
+
+    while (true)
+    {
+        Entry* root = holder.nodeR.load();
+
+        // Empty tree.
+        if (!root)
+        {
+            return false;
+        }
+
+        if (root->value == value)
+        {
+            const Node::Label* found = root->label.load();
+
+            if (found)
+            {
+                label = *found;
+            }
+
+            return found;
+        }
+
+        const unsigned long long version = root->version.load();
+
+        if (Shrinking(version))
+        {
+            Wait(root);
+        }
+
+        else if (root == holder.nodeR.load())
+        {
+            const Result result = Search(value, root, value > root->value, version, label);
+
+            if (result != RETRY)
+            {
+                return result == FOUND;
+            }
+        }
+    }
+}
+
+std::size_t Concurrent::Size() const
+{
+    Epoch::Guard guard;
+
+    std::size_t size = 0;
+    std::vector<const Entry*> entries;
+
+    if (const Entry* root = holder.nodeR.load())
+    {
+        entries.push_back(root);
+    }
+
+    while (!entries.empty())
+    {
+        const Entry* entry = entries.back();
+        entries.pop_back();
+
+        // Routing entries hold no value.
+        if (entry->label.load())
+        {
+            size++;
+        }
+
+        if (const Entry* nodeL = entry->nodeL.load())
+        {
+            entries.push_back(nodeL);
+        }
+
+        if (const Entry* nodeR = entry->nodeR.load())
+        {
+            entries.push_back(nodeR);
+        }
+    }
+
+    return size;
+}
+
+int Concurrent::Height() const
+{
+    Epoch::Guard guard;
+
+    return Height(holder.nodeR.load());
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr unsigned long long Concurrent::UNLINKED;
+
+constexpr unsigned long long Concurrent::SHRINKING;
+
+constexpr int Concurrent::UNLINK;
+
+constexpr int Concurrent::REPAIR;
+
+constexpr int Concurrent::NOTHING;
+
+constexpr std::size_t Concurrent::BATCH;
+
+//
+// Construct / Destruct
+//
+
+Concurrent::Entry::Entry(Node::Value value, const Node::Label* label, Concurrent::Entry* parent)
+    : value(value), label(label), height(1), version(0), parent(parent), nodeL(nullptr), nodeR(nullptr)
+{
+}
+
+std::atomic<Concurrent::Entry*>& Concurrent::Entry::Child(bool right)
+{
+    return (right) ? nodeR : nodeL;
+}
+
+//
+// Static Methods
+//
+
+bool Concurrent::Unlinked(unsigned long long version)
+{
+    return version == UNLINKED;
+}
+
+bool Concurrent::Shrinking(unsigned long long version)
+{
+    return (version & (UNLINKED | SHRINKING)) != 0;
+}
+
+bool Concurrent::Shrunk(unsigned long long before, unsigned long long after)
+{
+    // Only shrinking and unlinking change a version.
+    return before != after;
+}
+
+void Concurrent::Wait(Concurrent::Entry* entry)
+{
+    // Spin briefly, as rotations are short.
+    for (int i = 0; i < 100; i++)
+    {
+        if (!(entry->version.load() & SHRINKING))
+        {
+            return;
+        }
+    }
+
+    // Shrinking only happens with the entry locked.
+    if (entry->version.load() & SHRINKING)
+    {
+        std::lock_guard<std::mutex> guard(entry->lock);
+    }
+}
+
+int Concurrent::Height(const Concurrent::Entry* entry)
+{
+    return (entry) ? entry->height.load() : 0;
+}
+
+int Concurrent::Condition(Concurrent::Entry* entry)
+{
+    Entry* nodeL = entry->nodeL.load();
+    Entry* nodeR = entry->nodeR.load();
+
+    // Routing entries only stay linked while they have two children.
+    if ((!nodeL || !nodeR) && !entry->label.load())
+    {
+        return UNLINK;
+    }
+
+    const int height = entry->height.load();
+    const int heightL = Height(nodeL);
+    const int heightR = Height(nodeR);
+    const int repaired = 1 + std::max(heightL, heightR);
+    const int balance = heightL - heightR;
+
+    if (balance < -1 || balance > 1)
+    {
+        return REPAIR;
+    }
+
+    return (height != repaired) ? repaired : NOTHING;
+}
+
+//
+// Methods
+//
+
+Concurrent::Result Concurrent::Search(const Node::Value& value, Concurrent::Entry* entry, bool right,
+                                      unsigned long long version, Node::Label& label) const
+{
+    while (true)
+    {
+        Entry* child = entry->Child(right).load();
+
+        // Keys may have left the subtree; restart higher up.
+        if (Shrunk(version, entry->version.load()))
+        {
+            return RETRY;
+        }
+
+        // Expected an entry; unsuccessful search!
+        if (!child)
+        {
+            return MISSING;
+        }
+
+        // Found the matching value; routing entries don't count.
+        if (child->value == value)
+        {
+            const Node::Label* found = child->label.load();
+
+            if (!found)
+            {
+                return MISSING;
+            }
+
+            label = *found;
+
+            return FOUND;
+        }
+
+        const unsigned long long childVersion = child->version.load();
+
+        if (Shrinking(childVersion))
+        {
+            Wait(child);
+        }
+
+        // Validate the hand-over before descending.
+        else if (child == entry->Child(right).load() && !Shrunk(version, entry->version.load()))
+        {
+            const Result result = Search(value, child, value > child->value, childVersion, label);
+
+            if (result != RETRY)
+            {
+                return result;
+            }
+        }
+    }
+}
+
+Concurrent::Result Concurrent::Insert(const Node::Value& value, const Node::Label* label,
+                                      Concurrent::Entry* entry, bool right, unsigned long long version)
+{
+    while (true)
+    {
+        Entry* child = entry->Child(right).load();
+
+        // Keys may have left the subtree; restart higher up.
+        if (Shrunk(version, entry->version.load()))
+        {
+            return RETRY;
+        }
+
+        // Empty location found; attach a new leaf.
+        if (!child)
+        {
+            {
+                std::lock_guard<std::mutex> guard(entry->lock);
+
+                if (Shrunk(version, entry->version.load()))
+                {
+                    return RETRY;
+                }
+
+                // Another thread attached a child first.
+                if (entry->Child(right).load())
+                {
+                    continue;
+                }
+
+                entry->Child(right).store(new Entry(value, label, entry));
+            }
+
+            Repair(entry);
+
+            return FOUND;
+        }
+
+        if (child->value == value)
+        {
+            const Result result = Update(child, label);
+
+            if (result != RETRY)
+            {
+                return result;
+            }
+
+            continue;
+        }
+
+        const unsigned long long childVersion = child->version.load();
+
+        if (Shrinking(childVersion))
+        {
+            Wait(child);
+        }
+
+        // Validate the hand-over before descending.
+        else if (child == entry->Child(right).load() && !Shrunk(version, entry->version.load()))
+        {
+            const Result result = Insert(value, label, child, value > child->value, childVersion);
+
+            if (result != RETRY)
+            {
+                return result;
+            }
+        }
+    }
+}
+
+Concurrent::Result Concurrent::Remove(const Node::Value& value, Concurrent::Entry* entry, bool right,
+                                      unsigned long long version)
+{
+    while (true)
+    {
+        Entry* child = entry->Child(right).load();
+
+        // Keys may have left the subtree; restart higher up.
+        if (Shrunk(version, entry->version.load()))
+        {
+            return RETRY;
+        }
+
+        // Expected an entry; unsuccessful remove!
+        if (!child)
+        {
+            return MISSING;
+        }
+
+        if (child->value == value)
+        {
+            const Result result = Remove(entry, child);
+
+            if (result != RETRY)
+            {
+                return result;
+            }
+
+            continue;
+        }
+
+        const unsigned long long childVersion = child->version.load();
+
+        if (Shrinking(childVersion))
+        {
+            Wait(child);
+        }
+
+        // Validate the hand-over before descending.
+        else if (child == entry->Child(right).load() && !Shrunk(version, entry->version.load()))
+        {
+            const Result result = Remove(value, child, value > child->value, childVersion);
+
+            if (result != RETRY)
+            {
+                return result;
+            }
+        }
+    }
+}
+
+Concurrent::Result Concurrent::Update(Concurrent::Entry* entry, const Node::Label* label)
+{
+    std::lock_guard<std::mutex> guard(entry->lock);
+
+    if (Unlinked(entry->version.load()))
+    {
+        return RETRY;
+    }
+
+    // Values must be unique; unsuccessful insert!
+    if (entry->label.load())
+    {
+        return MISSING;
+    }
+
+    // Revive the routing entry.
+    entry->label.store(label);
+
+    return FOUND;
+}
+
+Concurrent::Result Concurrent::Remove(Concurrent::Entry* parent, Concurrent::Entry* entry)
+{
+    // Routing entries hold no value.
+    if (!entry->label.load())
+    {
+        return MISSING;
+    }
+
+    // Entries with two children only lose their label.
+    if (entry->nodeL.load() && entry->nodeR.load())
+    {
+        std::lock_guard<std::mutex> guard(entry->lock);
+
+        if (Unlinked(entry->version.load()))
+        {
+            return RETRY;
+        }
+
+        const Node::Label* label = entry->label.load();
+
+        if (!label)
+        {
+            return MISSING;
+        }
+
+        // A child was unlinked meanwhile; unlink instead.
+        if (!entry->nodeL.load() || !entry->nodeR.load())
+        {
+            return RETRY;
+        }
+
+        entry->label.store(nullptr);
+        Retire(label);
+
+        return FOUND;
+    }
+
+    {
+        std::lock_guard<std::mutex> guardParent(parent->lock);
+
+        if (Unlinked(parent->version.load()) || entry->parent.load() != parent)
+        {
+            return RETRY;
+        }
+
+        std::lock_guard<std::mutex> guard(entry->lock);
+
+        const Node::Label* label = entry->label.load();
+
+        if (!label)
+        {
+            return MISSING;
+        }
+
+        entry->label.store(nullptr);
+        Retire(label);
+
+        // Unlink now if possible; otherwise it stays as a routing entry.
+        if (!entry->nodeL.load() || !entry->nodeR.load())
+        {
+            Unlink(parent, entry);
+        }
+    }
+
+    Repair(parent);
+
+    return FOUND;
+}
+
+bool Concurrent::Unlink(Concurrent::Entry* parent, Concurrent::Entry* entry)
+{
+    Entry* parentL = parent->nodeL.load();
+    Entry* parentR = parent->nodeR.load();
+
+    if (parentL != entry && parentR != entry)
+    {
+        return false;
+    }
+
+    Entry* nodeL = entry->nodeL.load();
+    Entry* nodeR = entry->nodeR.load();
+
+    if (nodeL && nodeR)
+    {
+        return false;
+    }
+
+    Entry* splice = (nodeL) ? nodeL : nodeR;
+
+    if (parentL == entry)
+    {
+        parent->nodeL.store(splice);
+    }
+
+    else
+    {
+        parent->nodeR.store(splice);
+    }
+
+    if (splice)
+    {
+        splice->parent.store(parent);
+    }
+
+    entry->version.store(UNLINKED);
+    Retire(entry);
+
+    return true;
+}
+
+void Concurrent::Repair(Concurrent::Entry* entry)
+{
+    // The holder has no parent and is never repaired.
+    while (entry && entry->parent.load())
+    {
+        const int condition = Condition(entry);
+
+        if (condition == NOTHING || Unlinked(entry->version.load()))
+        {
+            return;
+        }
+
+        // Only the height is stale.
+        if (condition != UNLINK && condition != REPAIR)
+        {
+            std::lock_guard<std::mutex> guard(entry->lock);
+
+            entry = Fix(entry);
+        }
+
+        // Unlinking and rotating also modify the parent.
+        else
+        {
+            Entry* parent = entry->parent.load();
+            std::lock_guard<std::mutex> guardParent(parent->lock);
+
+            if (!Unlinked(parent->version.load()) && entry->parent.load() == parent)
+            {
+                std::lock_guard<std::mutex> guard(entry->lock);
+
+                entry = Repair(parent, entry);
+            }
+        }
+    }
+}
+
+Concurrent::Entry* Concurrent::Fix(Concurrent::Entry* entry)
+{
+    const int condition = Condition(entry);
+
+    if (condition == UNLINK || condition == REPAIR)
+    {
+        return entry;
+    }
+
+    if (condition == NOTHING)
+    {
+        return nullptr;
+    }
+
+    entry->height.store(condition);
+
+    return entry->parent.load();
+}
+
+Concurrent::Entry* Concurrent::Repair(Concurrent::Entry* parent, Concurrent::Entry* entry)
+{
+    Entry* nodeL = entry->nodeL.load();
+    Entry* nodeR = entry->nodeR.load();
+
+    if ((!nodeL || !nodeR) && !entry->label.load())
+    {
+        return (Unlink(parent, entry)) ? Fix(parent) : entry;
+    }
+
+    const int height = entry->height.load();
+    const int heightL = Height(nodeL);
+    const int heightR = Height(nodeR);
+    const int repaired = 1 + std::max(heightL, heightR);
+    const int balance = heightL - heightR;
+
+    if (balance > 1)
+    {
+        return RepairL(parent, entry, nodeL, heightR);
+    }
+
+    if (balance < -1)
+    {
+        return RepairR(parent, entry, nodeR, heightL);
+    }
+
+    if (repaired != height)
+    {
+        entry->height.store(repaired);
+
+        return Fix(parent);
+    }
+
+    return nullptr;
+}
+
+Concurrent::Entry* Concurrent::RepairL(Concurrent::Entry* parent, Concurrent::Entry* entry,
+                                       Concurrent::Entry* nodeL, int heightR)
+{
+    {
+        std::lock_guard<std::mutex> guardL(nodeL->lock);
+
+        // Already repaired by another thread.
+        if (nodeL->height.load() - heightR <= 1)
+        {
+            return entry;
+        }
+
+        Entry* nodeLR = nodeL->nodeR.load();
+        const int heightLL = Height(nodeL->nodeL.load());
+        const int heightLR = Height(nodeLR);
+
+        // L-L Case
+        if (heightLL >= heightLR)
+        {
+            return RotateR(parent, entry, nodeL, heightR, heightLL, nodeLR, heightLR);
+        }
+
+        {
+            std::lock_guard<std::mutex> guardLR(nodeLR->lock);
+
+            const int heightLRLocked = nodeLR->height.load();
+
+            if (heightLL >= heightLRLocked)
+            {
+                return RotateR(parent, entry, nodeL, heightR, heightLL, nodeLR, heightLRLocked);
+            }
+
+            const int heightLRL = Height(nodeLR->nodeL.load());
+            const int balance = heightLL - heightLRL;
+
+            // L-R Case, as long as it leaves no routing entry with a missing child.
+            if (balance >= -1 && balance <= 1 && !((heightLL == 0 || heightLRL == 0) && !nodeL->label.load()))
+            {
+                return RotateLR(parent, entry, nodeL, heightR, heightLL, nodeLR, heightLRL);
+            }
+        }
+
+        // Rotate the left child first, leaving the entry for the next pass.
+        return RepairR(entry, nodeL, nodeLR, heightLL);
+    }
+}
+
+Concurrent::Entry* Concurrent::RepairR(Concurrent::Entry* parent, Concurrent::Entry* entry,
+                                       Concurrent::Entry* nodeR, int heightL)
+{
+    {
+        std::lock_guard<std::mutex> guardR(nodeR->lock);
+
+        // Already repaired by another thread.
+        if (nodeR->height.load() - heightL <= 1)
+        {
+            return entry;
+        }
+
+        Entry* nodeRL = nodeR->nodeL.load();
+        const int heightRR = Height(nodeR->nodeR.load());
+        const int heightRL = Height(nodeRL);
+
+        // R-R Case
+        if (heightRR >= heightRL)
+        {
+            return RotateL(parent, entry, nodeR, heightL, heightRR, nodeRL, heightRL);
+        }
+
+        {
+            std::lock_guard<std::mutex> guardRL(nodeRL->lock);
+
+            const int heightRLLocked = nodeRL->height.load();
+
+            if (heightRR >= heightRLLocked)
+            {
+                return RotateL(parent, entry, nodeR, heightL, heightRR, nodeRL, heightRLLocked);
+            }
+
+            const int heightRLR = Height(nodeRL->nodeR.load());
+            const int balance = heightRR - heightRLR;
+
+            // R-L Case, as long as it leaves no routing entry with a missing child.
+            if (balance >= -1 && balance <= 1 && !((heightRR == 0 || heightRLR == 0) && !nodeR->label.load()))
+            {
+                return RotateRL(parent, entry, nodeR, heightL, heightRR, nodeRL, heightRLR);
+            }
+        }
+
+        // Rotate the right child first, leaving the entry for the next pass.
+        return RepairL(entry, nodeR, nodeRL, heightRR);
+    }
+}
+
+Concurrent::Entry* Concurrent::RotateR(Concurrent::Entry* parent, Concurrent::Entry* entry, Concurrent::Entry* nodeL,
+                                       int heightR, int heightLL, Concurrent::Entry* nodeLR, int heightLR)
+{
+    const unsigned long long version = entry->version.load();
+    Entry* parentL = parent->nodeL.load();
+
+    // Searches passing through the entry must wait or retry.
+    entry->version.store(version | SHRINKING);
+
+    entry->nodeL.store(nodeLR);
+    if (nodeLR)
+    {
+        nodeLR->parent.store(entry);
+    }
+
+    nodeL->nodeR.store(entry);
+    entry->parent.store(nodeL);
+
+    if (parentL == entry)
+    {
+        parent->nodeL.store(nodeL);
+    }
+
+    else
+    {
+        parent->nodeR.store(nodeL);
+    }
+
+    nodeL->parent.store(parent);
+
+    // Update heights.
+    const int repaired = 1 + std::max(heightLR, heightR);
+    entry->height.store(repaired);
+    nodeL->height.store(1 + std::max(heightLL, repaired));
+
+    entry->version.store(version + 2 * SHRINKING);
+
+    // The entry may still be damaged.
+    const int balance = heightLR - heightR;
+    if (balance < -1 || balance > 1 || ((!nodeLR || heightR == 0) && !entry->label.load()))
+    {
+        return entry;
+    }
+
+    // The new subtree root may still be damaged.
+    const int balanceL = heightLL - repaired;
+    if (balanceL < -1 || balanceL > 1 || (heightLL == 0 && !nodeL->label.load()))
+    {
+        return nodeL;
+    }
+
+    return Fix(parent);
+}
+
+Concurrent::Entry* Concurrent::RotateL(Concurrent::Entry* parent, Concurrent::Entry* entry, Concurrent::Entry* nodeR,
+                                       int heightL, int heightRR, Concurrent::Entry* nodeRL, int heightRL)
+{
+    const unsigned long long version = entry->version.load();
+    Entry* parentL = parent->nodeL.load();
+
+    // Searches passing through the entry must wait or retry.
+    entry->version.store(version | SHRINKING);
+
+    entry->nodeR.store(nodeRL);
+    if (nodeRL)
+    {
+        nodeRL->parent.store(entry);
+    }
+
+    nodeR->nodeL.store(entry);
+    entry->parent.store(nodeR);
+
+    if (parentL == entry)
+    {
+        parent->nodeL.store(nodeR);
+    }
+
+    else
+    {
+        parent->nodeR.store(nodeR);
+    }
+
+    nodeR->parent.store(parent);
+
+    // Update heights.
+    const int repaired = 1 + std::max(heightL, heightRL);
+    entry->height.store(repaired);
+    nodeR->height.store(1 + std::max(repaired, heightRR));
+
+    entry->version.store(version + 2 * SHRINKING);
+
+    // The entry may still be damaged.
+    const int balance = heightRL - heightL;
+    if (balance < -1 || balance > 1 || ((!nodeRL || heightL == 0) && !entry->label.load()))
+    {
+        return entry;
+    }
+
+    // The new subtree root may still be damaged.
+    const int balanceR = heightRR - repaired;
+    if (balanceR < -1 || balanceR > 1 || (heightRR == 0 && !nodeR->label.load()))
+    {
+        return nodeR;
+    }
+
+    return Fix(parent);
+}
+
+Concurrent::Entry* Concurrent::RotateLR(Concurrent::Entry* parent, Concurrent::Entry* entry, Concurrent::Entry* nodeL,
+                                        int heightR, int heightLL, Concurrent::Entry* nodeLR, int heightLRL)
+{
+    const unsigned long long version = entry->version.load();
+    const unsigned long long versionL = nodeL->version.load();
+
+    Entry* parentL = parent->nodeL.load();
+    Entry* nodeLRL = nodeLR->nodeL.load();
+    Entry* nodeLRR = nodeLR->nodeR.load();
+    const int heightLRR = Height(nodeLRR);
+
+    // Both the entry and its left child move down.
+    entry->version.store(version | SHRINKING);
+    nodeL->version.store(versionL | SHRINKING);
+
+    entry->nodeL.store(nodeLRR);
+    if (nodeLRR)
+    {
+        nodeLRR->parent.store(entry);
+    }
+
+    nodeL->nodeR.store(nodeLRL);
+    if (nodeLRL)
+    {
+        nodeLRL->parent.store(nodeL);
+    }
+
+    nodeLR->nodeL.store(nodeL);
+    nodeL->parent.store(nodeLR);
+    nodeLR->nodeR.store(entry);
+    entry->parent.store(nodeLR);
+
+    if (parentL == entry)
+    {
+        parent->nodeL.store(nodeLR);
+    }
+
+    else
+    {
+        parent->nodeR.store(nodeLR);
+    }
+
+    nodeLR->parent.store(parent);
+
+    // Update heights.
+    const int repaired = 1 + std::max(heightLRR, heightR);
+    const int repairedL = 1 + std::max(heightLL, heightLRL);
+    entry->height.store(repaired);
+    nodeL->height.store(repairedL);
+    nodeLR->height.store(1 + std::max(repairedL, repaired));
+
+    entry->version.store(version + 2 * SHRINKING);
+    nodeL->version.store(versionL + 2 * SHRINKING);
+
+    // The entry may still be damaged.
+    const int balance = heightLRR - heightR;
+    if (balance < -1 || balance > 1 || ((!nodeLRR || heightR == 0) && !entry->label.load()))
+    {
+        return entry;
+    }
+
+    // The new subtree root may still be damaged.
+    const int balanceLR = repairedL - repaired;
+    if (balanceLR < -1 || balanceLR > 1)
+    {
+        return nodeLR;
+    }
+
+    return Fix(parent);
+}
+
+Concurrent::Entry* Concurrent::RotateRL(Concurrent::Entry* parent, Concurrent::Entry* entry, Concurrent::Entry* nodeR,
+                                        int heightL, int heightRR, Concurrent::Entry* nodeRL, int heightRLR)
+{
+    const unsigned long long version = entry->version.load();
+    const unsigned long long versionR = nodeR->version.load();
+
+    Entry* parentL = parent->nodeL.load();
+    Entry* nodeRLL = nodeRL->nodeL.load();
+    Entry* nodeRLR = nodeRL->nodeR.load();
+    const int heightRLL = Height(nodeRLL);
+
+    // Both the entry and its right child move down.
+    entry->version.store(version | SHRINKING);
+    nodeR->version.store(versionR | SHRINKING);
+
+    entry->nodeR.store(nodeRLL);
+    if (nodeRLL)
+    {
+        nodeRLL->parent.store(entry);
+    }
+
+    nodeR->nodeL.store(nodeRLR);
+    if (nodeRLR)
+    {
+        nodeRLR->parent.store(nodeR);
+    }
+
+    nodeRL->nodeR.store(nodeR);
+    nodeR->parent.store(nodeRL);
+    nodeRL->nodeL.store(entry);
+    entry->parent.store(nodeRL);
+
+    if (parentL == entry)
+    {
+        parent->nodeL.store(nodeRL);
+    }
+
+    else
+    {
+        parent->nodeR.store(nodeRL);
+    }
+
+    nodeRL->parent.store(parent);
+
+    // Update heights.
+    const int repaired = 1 + std::max(heightL, heightRLL);
+    const int repairedR = 1 + std::max(heightRLR, heightRR);
+    entry->height.store(repaired);
+    nodeR->height.store(repairedR);
+    nodeRL->height.store(1 + std::max(repaired, repairedR));
+
+    entry->version.store(version + 2 * SHRINKING);
+    nodeR->version.store(versionR + 2 * SHRINKING);
+
+    // The entry may still be damaged.
+    const int balance = heightRLL - heightL;
+    if (balance < -1 || balance > 1 || ((!nodeRLL || heightL == 0) && !entry->label.load()))
+    {
+        return entry;
+    }
+
+    // The new subtree root may still be damaged.
+    const int balanceRL = repairedR - repaired;
+    if (balanceRL < -1 || balanceRL > 1)
+    {
+        return nodeRL;
+    }
+
+    return Fix(parent);
+}
+
+void Concurrent::Retire(Concurrent::Entry* entry)
+{
+    std::lock_guard<std::mutex> guard(retiredLock);
+
+    retiredEntries.push_back(entry);
+}
+
+void Concurrent::Retire(const Node::Label* label)
+{
+    std::lock_guard<std::mutex> guard(retiredLock);
+
+    retiredLabels.push_back(label);
+}
+
+void Concurrent::Reclaim()
+{
+    std::vector<Entry*> entries;
+    std::vector<const Node::Label*> labels;
+
+    {
+        std::lock_guard<std::mutex> guard(retiredLock);
+
+        if (retiredEntries.size() + retiredLabels.size() < BATCH)
+        {
+            return;
+        }
+
+        entries.swap(retiredEntries);
+        labels.swap(retiredLabels);
+    }
+
+    Epoch::Retire(entries);
+    Epoch::Retire(labels);
+}
@@ -0,0 +1,482 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_CONCURRENT_H
+#define PROJECT_1_CONCURRENT_H
+
+// std...
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// custom...
+#include "Node.h"
+
+/**
+ * @class Concurrent
+ *
+ * @brief Represents a concurrent, relaxed-balance AVL tree that any number of threads may search,
+ * insert into, and remove from at once, in the style of Bronson et al.'s
+ * "A Practical Concurrent Binary Search Tree" (PPoPP 2010).
+ *
+ * Every entry carries a version and a lock:
+ * - Searches descend optimistically, hand-over-hand, without taking any lock. Each step validates
+ *   that the parent's version hasn't shrunk (i.e., keys haven't left its subtree) since the step
+ *   began, and retries from the last valid entry otherwise.
+ * - Insertions lock only the entry that gains a child, and removals only the entry being removed
+ *   and its parent. An entry with two children is removed logically, becoming a routing entry
+ *   without a label, and is unlinked once it has fewer children.
+ * - Rebalancing is localized: heights are repaired bottom-up, and `RotateL`/`RotateR` run with
+ *   the parent, the entry, and its rotating child locked (top-down, so locks never deadlock),
+ *   marking the entry that moves down as shrinking for the duration.
+ *
+ * Since lock-free searches may still be reading an unlinked entry, every operation runs under an
+ * `Epoch::Guard`, and unlinked entries and removed labels are collected in batches of `BATCH` and
+ * retired through `Epoch`, which frees them once no operation that could reach them is running.
+ */
+class Concurrent
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs a new, empty tree.
+     *
+     * Time complexity: O(1)
+     */
+    Concurrent();
+
+    /**
+     * @brief Destroys the tree, freeing every entry and label it holds or has yet to retire.
+     * No other thread may be using the tree.
+     *
+     * Time complexity: O(n) where n is the number of entries in the tree.
+     */
+    ~Concurrent();
+
+    Concurrent(const Concurrent&) = delete;
+    Concurrent& operator=(const Concurrent&) = delete;
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Inserts the given value and label, unless the value is already present.
+     * Nothing is printed.
+     *
+     * @param value The value to be inserted.
+     * @param label The label to be associated with the value.
+     *
+     * @return `true` if inserted, `false` if the value was already present.
+     *
+     * Time complexity: O(log n) where n is the number of entries in the tree.
+     */
+    bool Insert(const Node::Value& value, const Node::Label& label);
+
+    /**
+     * @brief Removes the given value. Nothing is printed.
+     *
+     * @param value The value to be removed.
+     *
+     * @return `true` if removed, `false` if the value wasn't present.
+     *
+     * Time complexity: O(log n) where n is the number of entries in the tree.
+     */
+    bool Remove(const Node::Value& value);
+
+    /**
+     * @brief Searches for the given value without taking any lock. Nothing is printed.
+     *
+     * @param value The value to be searched for.
+     * @param label Set to the value's label, if found.
+     *
+     * @return `true` if found, `false` otherwise.
+     *
+     * Time complexity: O(log n) where n is the number of entries in the tree.
+     */
+    bool Search(const Node::Value& value, Node::Label& label) const;
+
+    /**
+     * @brief Counts the values in the tree. Only exact while no other thread mutates the tree.
+     *
+     * @return The number of values in the tree.
+     *
+     * Time complexity: O(n) where n is the number of entries in the tree.
+     */
+    std::size_t Size() const;
+
+    /**
+     * @brief Returns the height of the tree.
+     *
+     * @return The height of the tree, or `0` if it is empty.
+     *
+     * Time complexity: O(1)
+     */
+    int Height() const;
+
+private:
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Entry
+     * @brief Represents an entry of the tree. Everything but the value may change concurrently.
+     */
+    struct Entry
+    {
+        /**
+         * @brief Constructs a new entry.
+         *
+         * @param value The value of the entry.
+         * @param label The label of the entry, or null for a routing entry.
+         * @param parent The parent of the entry.
+         */
+        Entry(Node::Value value, const Node::Label* label, Entry* parent);
+
+        /**
+         * @brief Returns the child in the given direction.
+         *
+         * @param right Whether the right child is wanted.
+         *
+         * @return The child in the given direction.
+         */
+        std::atomic<Entry*>& Child(bool right);
+
+        /**
+         * @brief The value of the entry, fixed for its lifetime.
+         */
+        const Node::Value value;
+
+        /**
+         * @brief The label of the entry, or null if the entry is only routing.
+         */
+        std::atomic<const Node::Label*> label;
+
+        /**
+         * @brief The (possibly stale) height of the entry.
+         */
+        std::atomic<int> height;
+
+        /**
+         * @brief The version of the entry. See `Unlinked`, `Shrinking`, and `Shrunk`.
+         */
+        std::atomic<unsigned long long> version;
+
+        /**
+         * @brief The parent of the entry.
+         */
+        std::atomic<Entry*> parent;
+
+        /**
+         * @brief The left child of the entry.
+         */
+        std::atomic<Entry*> nodeL;
+
+        /**
+         * @brief The right child of the entry.
+         */
+        std::atomic<Entry*> nodeR;
+
+        /**
+         * @brief Held while modifying the entry's links, label, or height.
+         */
+        std::mutex lock;
+    };
+
+    /**
+     * @enum Result
+     * @brief Represents the outcome of a single optimistic attempt.
+     */
+    enum Result
+    {
+        /**
+         * @brief The attempt found (or changed) the value.
+         */
+        FOUND,
+
+        /**
+         * @brief The attempt didn't find (or change) the value.
+         */
+        MISSING,
+
+        /**
+         * @brief The attempt was invalidated by a concurrent change and must restart higher up.
+         */
+        RETRY,
+    };
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the version of an unlinked entry. Versions are otherwise a multiple of four,
+     * with `SHRINKING` set for the duration of a rotation moving the entry down.
+     */
+    static constexpr unsigned long long UNLINKED = 1;
+
+    /**
+     * @brief Represents the version bit set while an entry is being shrunk by a rotation.
+     */
+    static constexpr unsigned long long SHRINKING = 2;
+
+    /**
+     * @brief Represents the condition of a routing entry that must be unlinked.
+     */
+    static constexpr int UNLINK = -1;
+
+    /**
+     * @brief Represents the condition of an entry that must be rotated.
+     */
+    static constexpr int REPAIR = -2;
+
+    /**
+     * @brief Represents the condition of an entry that requires nothing.
+     */
+    static constexpr int NOTHING = -3;
+
+    /**
+     * @brief Represents the number of unlinked entries and removed labels collected before they're
+     * retired through `Epoch`.
+     */
+    static constexpr std::size_t BATCH = 1024;
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Checks if the version marks an entry as unlinked from the tree.
+     */
+    static bool Unlinked(unsigned long long version);
+
+    /**
+     * @brief Checks if the version marks an entry as shrinking or unlinked.
+     */
+    static bool Shrinking(unsigned long long version);
+
+    /**
+     * @brief Checks if an entry shrank or was unlinked between the two versions.
+     */
+    static bool Shrunk(unsigned long long before, unsigned long long after);
+
+    /**
+     * @brief Waits for a rotation shrinking the given entry to finish.
+     */
+    static void Wait(Entry* entry);
+
+    /**
+     * @brief Safely returns the height of the given entry, `0` if null.
+     */
+    static int Height(const Entry* entry);
+
+    /**
+     * @brief Determines what the given entry requires: `UNLINK`, `REPAIR`, `NOTHING`, or otherwise
+     * the corrected height it should have.
+     *
+     * @param entry The entry to be checked.
+     *
+     * @return The requirement of the entry.
+     *
+     * Time complexity: O(1)
+     */
+    static int Condition(Entry* entry);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Optimistically searches the subtree of `entry` in direction `right`.
+     *
+     * @param value The value to be searched for.
+     * @param entry The entry whose subtree is searched.
+     * @param right The direction of the value from `entry`.
+     * @param version The version of `entry` when it was reached.
+     * @param label Set to the value's label, if found.
+     *
+     * @return The outcome of the attempt.
+     */
+    Result Search(const Node::Value& value, Entry* entry, bool right, unsigned long long version,
+                  Node::Label& label) const;
+
+    /**
+     * @brief Optimistically inserts into the subtree of `entry` in direction `right`.
+     *
+     * @param value The value to be inserted.
+     * @param label The label to be inserted; consumed if inserted.
+     * @param entry The entry whose subtree is inserted into.
+     * @param right The direction of the value from `entry`.
+     * @param version The version of `entry` when it was reached.
+     *
+     * @return The outcome of the attempt.
+     */
+    Result Insert(const Node::Value& value, const Node::Label* label, Entry* entry, bool right,
+                  unsigned long long version);
+
+    /**
+     * @brief Optimistically removes from the subtree of `entry` in direction `right`.
+     *
+     * @param value The value to be removed.
+     * @param entry The entry whose subtree is removed from.
+     * @param right The direction of the value from `entry`.
+     * @param version The version of `entry` when it was reached.
+     *
+     * @return The outcome of the attempt.
+     */
+    Result Remove(const Node::Value& value, Entry* entry, bool right, unsigned long long version);
+
+    /**
+     * @brief Sets the label of the given entry, if it is a routing entry.
+     *
+     * @param entry The entry holding the value to be inserted.
+     * @param label The label to be inserted; consumed if inserted.
+     *
+     * @return The outcome of the attempt.
+     */
+    Result Update(Entry* entry, const Node::Label* label);
+
+    /**
+     * @brief Removes the label of the given entry, unlinking the entry if it has fewer than two children.
+     *
+     * @param parent The parent of the entry.
+     * @param entry The entry holding the value to be removed.
+     *
+     * @return The outcome of the attempt.
+     */
+    Result Remove(Entry* parent, Entry* entry);
+
+    /**
+     * @brief Unlinks a routing entry with fewer than two children. Requires both entries locked.
+     *
+     * @param parent The parent of the entry.
+     * @param entry The entry to be unlinked.
+     *
+     * @return `true` if unlinked, `false` if the entry can't be unlinked right now.
+     */
+    bool Unlink(Entry* parent, Entry* entry);
+
+    /**
+     * @brief Walks up from the given entry, fixing heights and rotating until nothing is damaged.
+     *
+     * @param entry The lowest damaged entry.
+     *
+     * Time complexity: O(log n) where n is the number of entries in the tree.
+     */
+    void Repair(Entry* entry);
+
+    /**
+     * @brief Fixes the height of the given entry, if that's all it requires. Requires the entry locked.
+     *
+     * @return The next damaged entry, or null if nothing else is damaged.
+     */
+    Entry* Fix(Entry* entry);
+
+    /**
+     * @brief Unlinks, rotates, or fixes the height of the given entry. Requires both entries locked.
+     *
+     * @return The next damaged entry, or null if nothing else is damaged.
+     */
+    Entry* Repair(Entry* parent, Entry* entry);
+
+    /**
+     * @brief Rebalances an entry whose left subtree is too tall. Requires `parent` and `entry` locked.
+     *
+     * @return The next damaged entry, or null if nothing else is damaged.
+     */
+    Entry* RepairL(Entry* parent, Entry* entry, Entry* nodeL, int heightR);
+
+    /**
+     * @brief Rebalances an entry whose right subtree is too tall. Requires `parent` and `entry` locked.
+     *
+     * @return The next damaged entry, or null if nothing else is damaged.
+     */
+    Entry* RepairR(Entry* parent, Entry* entry, Entry* nodeR, int heightL);
+
+    /**
+     * @brief Performs a right rotation of `entry` over its left child. Requires all three locked.
+     *
+     * @return The next damaged entry, or null if nothing else is damaged.
+     *
+     * Time complexity: O(1)
+     */
+    Entry* RotateR(Entry* parent, Entry* entry, Entry* nodeL, int heightR, int heightLL, Entry* nodeLR, int heightLR);
+
+    /**
+     * @brief Performs a left rotation of `entry` over its right child. Requires all three locked.
+     *
+     * @return The next damaged entry, or null if nothing else is damaged.
+     *
+     * Time complexity: O(1)
+     */
+    Entry* RotateL(Entry* parent, Entry* entry, Entry* nodeR, int heightL, int heightRR, Entry* nodeRL, int heightRL);
+
+    /**
+     * @brief Performs a left-right rotation of `entry`. Requires all four entries locked.
+     *
+     * @return The next damaged entry, or null if nothing else is damaged.
+     *
+     * Time complexity: O(1)
+     */
+    Entry* RotateLR(Entry* parent, Entry* entry, Entry* nodeL, int heightR, int heightLL, Entry* nodeLR, int heightLRL);
+
+    /**
+     * @brief Performs a right-left rotation of `entry`. Requires all four entries locked.
+     *
+     * @return The next damaged entry, or null if nothing else is damaged.
+     *
+     * Time complexity: O(1)
+     */
+    Entry* RotateRL(Entry* parent, Entry* entry, Entry* nodeR, int heightL, int heightRR, Entry* nodeRL, int heightRLR);
+
+    /**
+     * @brief Collects an unlinked entry, to be retired through `Epoch`.
+     */
+    void Retire(Entry* entry);
+
+    /**
+     * @brief Collects a removed label, to be retired through `Epoch`.
+     */
+    void Retire(const Node::Label* label);
+
+    /**
+     * @brief Retires the collected entries and labels through `Epoch`, once at least `BATCH` are.
+     *
+     * Time complexity: O(t + b) where t is the number of reader slots of `Epoch` and b the number
+     * of entries and labels retired or freed; O(1) while fewer than `BATCH` are collected.
+     */
+    void Reclaim();
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the sentinel whose right child is the root of the tree. Never unlinked.
+     */
+    Entry holder;
+
+    /**
+     * @brief Represents the unlinked entries not yet retired.
+     */
+    std::vector<Entry*> retiredEntries;
+
+    /**
+     * @brief Represents the removed labels not yet retired.
+     */
+    std::vector<const Node::Label*> retiredLabels;
+
+    /**
+     * @brief Guards `retiredEntries` and `retiredLabels`.
+     */
+    std::mutex retiredLock;
+};
+
+#endif //PROJECT_1_CONCURRENT_H
@@ -0,0 +1,75 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_ENGINE_H
+#define PROJECT_1_ENGINE_H
+
+// custom...
+#include "Node.h"
+
+/**
+ * @class Engine
+ *
+ * @brief Represents a storage engine the Command Line Argument Parser (C.L.A.P.) can run its commands
+ * against in place of the single AVL tree rooted at `Clap::root`.
+ *
+ * Every method prints exactly what the matching `Node` method prints for the same command, so
+ * an engine is interchangeable with the default tree as far as clients can tell.
+ *
+ * Engines synchronize themselves: any method may be called from any number of threads at once.
+ */
+class Engine
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Destroys the engine and everything it stores.
+     */
+    virtual ~Engine() = default;
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Inserts the given value and label. See `Node::Insert`.
+     */
+    virtual void Insert(const Node::Value& value, const Node::Label& label) = 0;
+
+    /**
+     * @brief Removes the given value. See `Node::Remove`.
+     */
+    virtual void Remove(const Node::Value& value) = 0;
+
+    /**
+     * @brief Removes the n-th value in order. See `Node::Remove`.
+     */
+    virtual void Remove(unsigned int n) = 0;
+
+    /**
+     * @brief Searches for the given value. See `Node::Search`.
+     */
+    virtual void Search(const Node::Value& value) = 0;
+
+    /**
+     * @brief Searches for the values with the given label. See `Node::Search`.
+     */
+    virtual void Search(const Node::Label& label) = 0;
+
+    /**
+     * @brief Prints the labels in the given order. See `Node::Print`.
+     */
+    virtual void Print(Node::Order order) = 0;
+
+    /**
+     * @brief Prints the number of levels. See `Node::Print`.
+     */
+    virtual void Print() = 0;
+};
+
+#endif //PROJECT_1_ENGINE_H
@@ -0,0 +1,142 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <thread>
+
+// custom...
+#include "Epoch.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Epoch::Guard::Guard()
+{
+    if (depth++ == 0)
+    {
+        // Announce before the reader loads the root, so no writer can miss it.
+        slots[Slot()].store(global.load() + 1);
+    }
+}
+
+Epoch::Guard::~Guard()
+{
+    if (--depth == 0)
+    {
+        slots[Slot()].store(0, std::memory_order_release);
+    }
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr std::size_t Epoch::capacity;
+
+std::atomic<unsigned long long> Epoch::global(0);
+
+std::atomic<unsigned long long> Epoch::slots[Epoch::capacity] = {};
+
+std::atomic<bool> Epoch::claimed[Epoch::capacity] = {};
+
+std::deque<Epoch::Limbo> Epoch::limbo;
+
+std::mutex Epoch::mutex;
+
+thread_local unsigned int Epoch::depth = 0;
+
+//
+// Static Methods
+//
+
+std::size_t Epoch::Slot()
+{
+    /**
+     * Releases the thread's slot when the thread exits.
+     */
+    struct Claim
+    {
+        std::size_t index = capacity;
+
+        ~Claim()
+        {
+            if (index < capacity)
+            {
+                slots[index].store(0);
+                claimed[index].store(false);
+            }
+        }
+    };
+
+    static thread_local Claim claim;
+
+    // Wait for a thread to exit if every slot is taken.
+    while (claim.index == capacity)
+    {
+        for (std::size_t i = 0; i < capacity; i++)
+        {
+            bool expected = false;
+
+            if (claimed[i].compare_exchange_strong(expected, true))
+            {
+                claim.index = i;
+
+                break;
+            }
+        }
+
+        if (claim.index == capacity)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    return claim.index;
+}
+
+void Epoch::Collect(std::vector<Epoch::Garbage>& garbage)
+{
+    std::lock_guard<std::mutex> guard(mutex);
+
+    // The objects are already unreachable for readers announcing a later epoch.
+    if (!garbage.empty())
+    {
+        limbo.push_back({global.fetch_add(1), std::move(garbage)});
+        garbage.clear();
+    }
+
+    // Find the oldest epoch still announced.
+    unsigned long long oldest = global.load();
+    for (const auto& slot : slots)
+    {
+        const unsigned long long announced = slot.load();
+
+        if (announced && announced - 1 < oldest)
+        {
+            oldest = announced - 1;
+        }
+    }
+
+    // Free every batch retired before it.
+    while (!limbo.empty() && limbo.front().epoch < oldest)
+    {
+        for (const Garbage& retired : limbo.front().garbage)
+        {
+            retired.free(retired.object);
+        }
+
+        limbo.pop_front();
+    }
+}
@@ -0,0 +1,194 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_EPOCH_H
+#define PROJECT_1_EPOCH_H
+
+// std...
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// custom...
+#include "Node.h"
+
+/**
+ * @class Epoch
+ *
+ * @brief Implements epoch-based reclamation (EBR) for nodes unlinked from a tree that lock-free
+ * readers may still be traversing. Entries of other trees are retired the same way.
+ *
+ * Readers wrap every traversal in a `Guard`, which announces the global epoch the reader
+ * started in. Writers hand the nodes they unlinked to `Retire`, which stamps them with the
+ * current epoch and advances it. A batch of retired nodes is freed once every active reader
+ * announced a later epoch, as those readers started after the nodes became unreachable.
+ *
+ * Readers never block and never take a lock; only writers contend on the retirement list.
+ */
+class Epoch
+{
+public:
+
+    /**
+     * @class Guard
+     * @brief While alive, keeps every node reachable at its creation from being freed.
+     * Guards may nest on the same thread.
+     */
+    class Guard
+    {
+    public:
+
+        /**
+         * @brief Announces the current epoch for the calling thread.
+         *
+         * Time complexity: O(1)
+         */
+        Guard();
+
+        /**
+         * @brief Withdraws the calling thread's announcement, unless an outer guard is still alive.
+         *
+         * Time complexity: O(1)
+         */
+        ~Guard();
+    };
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Defers freeing the given objects until no reader can still reach them, then frees
+     * every earlier batch that became safe.
+     *
+     * @param objects The nodes, or entries and labels of another tree, unlinked from the tree.
+     * Emptied by the call.
+     *
+     * Time complexity: O(t + n) where t is the number of reader slots and n the number of objects
+     * retired or freed.
+     */
+    template <typename T>
+    static void Retire(std::vector<T*>& objects)
+    {
+        std::vector<Garbage> garbage;
+        garbage.reserve(objects.size());
+
+        for (T* object : objects)
+        {
+            garbage.push_back({const_cast<void*>(static_cast<const void*>(object)), [](void* retired)
+            {
+                delete static_cast<T*>(retired);
+            }});
+        }
+
+        objects.clear();
+        Collect(garbage);
+    }
+
+private:
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Garbage
+     * @brief Represents a retired object and how to free it.
+     */
+    struct Garbage
+    {
+        /**
+         * @brief The retired object.
+         */
+        void* object;
+
+        /**
+         * @brief Frees the retired object.
+         */
+        void (*free)(void*);
+    };
+
+    /**
+     * @struct Limbo
+     * @brief Represents a batch of retired objects awaiting a grace period.
+     */
+    struct Limbo
+    {
+        /**
+         * @brief The epoch the objects were retired in.
+         */
+        unsigned long long epoch;
+
+        /**
+         * @brief The retired objects.
+         */
+        std::vector<Garbage> garbage;
+    };
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Returns the calling thread's reader slot, claiming a free one on first use.
+     * The slot is released when the thread exits.
+     *
+     * @return The index of the slot.
+     *
+     * Time complexity: O(t) on first use where t is the number of reader slots, O(1) afterwards.
+     */
+    static std::size_t Slot();
+
+    /**
+     * @brief Stamps the given objects with the current epoch and advances it, then frees every
+     * earlier batch that became safe.
+     *
+     * @param garbage The retired objects. Emptied by the call.
+     *
+     * Time complexity: O(t + n) where t is the number of reader slots and n the number of objects freed.
+     */
+    static void Collect(std::vector<Garbage>& garbage);
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the number of threads that may read at once.
+     */
+    static constexpr std::size_t capacity = 256;
+
+    /**
+     * @brief Represents the global epoch.
+     */
+    static std::atomic<unsigned long long> global;
+
+    /**
+     * @brief Represents each reader's announced epoch plus one, or `0` while the reader is idle.
+     */
+    static std::atomic<unsigned long long> slots[capacity];
+
+    /**
+     * @brief Represents whether each reader slot belongs to a thread.
+     */
+    static std::atomic<bool> claimed[capacity];
+
+    /**
+     * @brief Represents the retired batches, oldest first.
+     */
+    static std::deque<Limbo> limbo;
+
+    /**
+     * @brief Guards `limbo`.
+     */
+    static std::mutex mutex;
+
+    /**
+     * @brief Represents how many guards the calling thread currently holds.
+     */
+    static thread_local unsigned int depth;
+};
+
+#endif //PROJECT_1_EPOCH_H
@@ -0,0 +1,132 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// custom...
+#include "Frozen.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Frozen::Frozen(const Tree& tree)
+{
+    std::vector<const Node*> nodes;
+    Flatten(tree.Root(), nodes);
+
+    std::vector<const Node*> layout(nodes.size() + 1, nullptr);
+    std::size_t i = 0;
+    Fill(nodes, i, 1, layout);
+
+    this->values.resize(layout.size());
+    this->labels.resize(layout.size());
+
+    for (std::size_t k = 1; k < layout.size(); k++)
+    {
+        this->values[k] = layout[k]->value;
+        this->labels[k] = layout[k]->label;
+    }
+}
+
+//
+// Methods
+//
+
+bool Frozen::Search(const Node::Value& value) const
+{
+    Intern::Handle label;
+
+    // Found the matching value; successful search!
+    if (Find(value, label))
+    {
+        Node::Print(Intern::Get(label));
+
+        return true;
+    }
+
+    // No such value; unsuccessful search!
+    Node::PrintFailure();
+
+    return false;
+}
+
+bool Frozen::Find(const Node::Value& value, Intern::Handle& label) const
+{
+    const std::size_t n = this->values.size() - 1;
+    const std::uint32_t* values = this->values.data();
+
+    // Descend without branching on the comparisons: k gains one bit per level, 1 if went right.
+    std::size_t k = 1;
+    while (k <= n)
+    {
+#if defined(__GNUC__)
+        // Sixteen values per cache line; fetch the line holding the descendants four levels down.
+        __builtin_prefetch(values + 16 * k);
+#endif
+
+        k = 2 * k + (values[k] < value);
+    }
+
+    // Undo the trailing right turns, and the final left turn, to land on the lower bound.
+#if defined(__GNUC__)
+    k >>= __builtin_ffsll(static_cast<long long>(~k));
+#else
+    while (k & 1)
+    {
+        k >>= 1;
+    }
+
+    k >>= 1;
+#endif
+
+    // Found the matching value.
+    if (k != 0 && values[k] == value)
+    {
+        label = this->labels[k];
+
+        return true;
+    }
+
+    return false;
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Static Methods
+//
+
+void Frozen::Flatten(const Node* root, std::vector<const Node*>& nodes)
+{
+    // Base case.
+    if (!root)
+    {
+        return;
+    }
+
+    Flatten(root->nodeL, nodes);
+    nodes.push_back(root);
+    Flatten(root->nodeR, nodes);
+}
+
+void Frozen::Fill(const std::vector<const Node*>& nodes, std::size_t& i, std::size_t k, std::vector<const Node*>& layout)
+{
+    // Base case.
+    if (k > nodes.size())
+    {
+        return;
+    }
+
+    // An in-order walk of the implicit tree visits the indices in sorted order.
+    Fill(nodes, i, 2 * k, layout);
+    layout[k] = nodes[i++];
+    Fill(nodes, i, 2 * k + 1, layout);
+}
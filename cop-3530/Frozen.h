@@ -0,0 +1,113 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_FROZEN_H
+#define PROJECT_1_FROZEN_H
+
+// std...
+#include <cstdint>
+#include <vector>
+
+// custom...
+#include "Node.h"
+#include "Tree.h"
+
+/**
+ * @class Frozen
+ *
+ * @brief Represents an immutable copy of the AVL tree laid out for fast point lookups.
+ *
+ * The values are stored in Eytzinger (breadth-first) order: the root at index 1, and the children
+ * of index k at 2k and 2k + 1. A search then walks a single contiguous array with no pointers to
+ * chase, and its path is computed without branching on the comparisons; the first levels share
+ * cache lines, and the next ones are prefetched ahead of time.
+ *
+ * The handles of the interned labels are stored in the same order, in a parallel array.
+ */
+class Frozen
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs a frozen copy of the given tree.
+     *
+     * @param tree The tree to be copied.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the tree.
+     */
+    explicit Frozen(const Tree& tree);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Searches for the given value. If found, its label is printed.
+     * Otherwise, "unsuccessful" is printed. See `Node::Search`.
+     *
+     * @param value The value to be searched for.
+     *
+     * @return `true` if the value was found, `false` otherwise.
+     *
+     * Time complexity: O(log n) where n is the number of values.
+     */
+    bool Search(const Node::Value& value) const;
+
+    /**
+     * @brief Finds the label of the given value. Nothing is printed.
+     *
+     * @param value The value to be found.
+     * @param label Set to the handle of the value's label, if found.
+     *
+     * @return `true` if the value was found, `false` otherwise.
+     *
+     * Time complexity: O(log n) where n is the number of values.
+     */
+    bool Find(const Node::Value& value, Intern::Handle& label) const;
+
+private:
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Collects the nodes of the tree rooted at the given node in in-order sequence.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    static void Flatten(const Node* root, std::vector<const Node*>& nodes);
+
+    /**
+     * @brief Places the given sorted nodes at their Eytzinger indices, starting from index k.
+     *
+     * @param nodes The nodes, in in-order sequence.
+     * @param i The index of the next node of `nodes` to be placed.
+     * @param k The Eytzinger index to be filled.
+     * @param layout The nodes, by Eytzinger index.
+     *
+     * Time complexity: O(n) where n is the number of nodes.
+     */
+    static void Fill(const std::vector<const Node*>& nodes, std::size_t& i, std::size_t k, std::vector<const Node*>& layout);
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the values in Eytzinger order. Index 0 is unused.
+     */
+    std::vector<std::uint32_t> values;
+
+    /**
+     * @brief Represents the labels of `values`, in the same order. Index 0 is unused.
+     */
+    std::vector<Intern::Handle> labels;
+};
+
+#endif //PROJECT_1_FROZEN_H
@@ -0,0 +1,516 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <utility>
+
+// custom...
+#include "Grams.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Methods
+//
+
+void Grams::Add(const Node::Label& label, std::uint32_t value)
+{
+    Remove(value);
+
+    for (const std::uint32_t trigram : Trigrams(label))
+    {
+        Insert(trigram, value);
+    }
+
+    this->labels[value] = Intern::Add(label);
+}
+
+void Grams::Remove(std::uint32_t value)
+{
+    const auto found = this->labels.find(value);
+
+    if (found == this->labels.end())
+    {
+        return;
+    }
+
+    for (const std::uint32_t trigram : Trigrams(Intern::Get(found->second)))
+    {
+        Erase(trigram, value);
+    }
+
+    this->labels.erase(found);
+}
+
+void Grams::Search(const Node::Label& label, std::size_t k) const
+{
+    // No values asked for; unsuccessful search!
+    if (!k)
+    {
+        Node::PrintFailure();
+
+        return;
+    }
+
+    const std::vector<std::uint32_t> trigrams = Trigrams(label);
+
+    // The number of the label's trigrams each value shares.
+    std::unordered_map<std::uint32_t, std::size_t> shared;
+    std::vector<std::uint32_t> values;
+
+    for (const std::uint32_t trigram : trigrams)
+    {
+        const auto found = this->postings.find(trigram);
+
+        if (found == this->postings.end())
+        {
+            continue;
+        }
+
+        values.clear();
+
+        for (const Block& block : found->second)
+        {
+            Decode(block, values);
+        }
+
+        for (const std::uint32_t value : values)
+        {
+            shared[value]++;
+        }
+    }
+
+    std::vector<std::pair<std::size_t, std::uint32_t>> candidates;
+    candidates.reserve(shared.size());
+
+    for (const auto& entry : shared)
+    {
+        candidates.emplace_back(entry.second, entry.first);
+    }
+
+    // Most shared trigrams first, as they're likely the fewest edits away.
+    std::sort(candidates.begin(), candidates.end(), [](const std::pair<std::size_t, std::uint32_t>& a, const std::pair<std::size_t, std::uint32_t>& b)
+    {
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+    });
+
+    // The closest values so far, by edits then value; the farthest one kept last.
+    std::vector<std::pair<std::size_t, std::uint32_t>> closest;
+
+    for (const std::pair<std::size_t, std::uint32_t>& candidate : candidates)
+    {
+        // Every value left is more edits away than the farthest one kept.
+        if (closest.size() == k && trigrams.size() > candidate.first + 3 * closest.back().first)
+        {
+            break;
+        }
+
+        const std::pair<std::size_t, std::uint32_t> ranked(Distance(label, Intern::Get(this->labels.at(candidate.second))), candidate.second);
+
+        if (closest.size() < k || ranked < closest.back())
+        {
+            closest.insert(std::upper_bound(closest.begin(), closest.end(), ranked), ranked);
+
+            if (closest.size() > k)
+            {
+                closest.pop_back();
+            }
+        }
+    }
+
+    std::string result;
+
+    for (const std::pair<std::size_t, std::uint32_t>& entry : closest)
+    {
+        result.append(Node::Pad(entry.second));
+        result.append("\n");
+    }
+
+    if (!result.empty())
+    {
+        // Print, but remove the last newline insertion.
+        Node::Print(result.substr(0, result.size() - 1));
+    }
+
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void Grams::Rebuild(const Node* root)
+{
+    this->postings.clear();
+    this->labels.clear();
+    this->bytes = 0;
+
+    Fill(root);
+}
+
+std::size_t Grams::Size() const
+{
+    return this->labels.size();
+}
+
+std::size_t Grams::Count() const
+{
+    return this->postings.size();
+}
+
+std::size_t Grams::Bytes() const
+{
+    return this->bytes;
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr std::uint32_t Grams::capacity;
+
+//
+// Static Methods
+//
+
+std::vector<std::uint32_t> Grams::Trigrams(const Node::Label& label)
+{
+    std::string padded = "  " + label + " ";
+
+    for (char& letter : padded)
+    {
+        letter = static_cast<char>(std::tolower(static_cast<unsigned char>(letter)));
+    }
+
+    std::vector<std::uint32_t> trigrams;
+    trigrams.reserve(padded.size() - 2);
+
+    for (std::size_t i = 0; i + 2 < padded.size(); i++)
+    {
+        trigrams.push_back(static_cast<std::uint32_t>(static_cast<std::uint8_t>(padded[i])) << 16
+            | static_cast<std::uint32_t>(static_cast<std::uint8_t>(padded[i + 1])) << 8
+            | static_cast<std::uint32_t>(static_cast<std::uint8_t>(padded[i + 2])));
+    }
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+
+    return trigrams;
+}
+
+std::size_t Grams::Distance(const std::string& a, const std::string& b)
+{
+    // The edits between the first i letters of `a` and the first j of `b`, a row of i at a time.
+    std::vector<std::size_t> row(b.size() + 1);
+
+    for (std::size_t j = 0; j <= b.size(); j++)
+    {
+        row[j] = j;
+    }
+
+    for (std::size_t i = 1; i <= a.size(); i++)
+    {
+        std::size_t diagonal = row[0];
+        row[0] = i;
+
+        for (std::size_t j = 1; j <= b.size(); j++)
+        {
+            const std::size_t above = row[j];
+            const bool same = std::tolower(static_cast<unsigned char>(a[i - 1])) == std::tolower(static_cast<unsigned char>(b[j - 1]));
+
+            row[j] = std::min({ above + 1, row[j - 1] + 1, diagonal + (same ? 0 : 1) });
+            diagonal = above;
+        }
+    }
+
+    return row[b.size()];
+}
+
+void Grams::Append(Grams::Block& block, std::uint32_t value)
+{
+    std::uint8_t encoded[5];
+
+    // The first value as is, then the gap to the previous one.
+    block.bytes.insert(block.bytes.end(), encoded, encoded + Varint(block.size ? value - block.last : value, encoded));
+
+    block.last = value;
+    block.size++;
+}
+
+void Grams::Decode(const Grams::Block& block, std::vector<std::uint32_t>& output)
+{
+    std::uint32_t value = 0;
+    std::uint32_t gap = 0;
+    int shift = 0;
+
+    for (const std::uint8_t byte : block.bytes)
+    {
+        gap |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+        shift += 7;
+
+        if (!(byte & 0x80))
+        {
+            value += gap;
+            output.push_back(value);
+
+            gap = 0;
+            shift = 0;
+        }
+    }
+}
+
+void Grams::Encode(Grams::Block& block, std::vector<std::uint32_t>::const_iterator first, std::vector<std::uint32_t>::const_iterator last)
+{
+    // Cleared rather than replaced, so its bytes keep their capacity.
+    block.bytes.clear();
+    block.last = 0;
+    block.size = 0;
+
+    for (auto it = first; it != last; ++it)
+    {
+        Append(block, *it);
+    }
+}
+
+std::size_t Grams::Varint(std::uint32_t gap, std::uint8_t* output)
+{
+    std::size_t length = 0;
+
+    // Seven bits per byte, the high bit set on every byte but the last.
+    do
+    {
+        output[length++] = static_cast<std::uint8_t>((gap & 0x7F) | (gap > 0x7F ? 0x80 : 0));
+        gap >>= 7;
+    }
+    while (gap);
+
+    return length;
+}
+
+std::size_t Grams::Read(const std::vector<std::uint8_t>& bytes, std::size_t offset, std::uint32_t& gap)
+{
+    gap = 0;
+
+    for (int shift = 0; ; shift += 7)
+    {
+        const std::uint8_t byte = bytes[offset++];
+        gap |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+
+        if (!(byte & 0x80))
+        {
+            return offset;
+        }
+    }
+}
+
+Grams::Posting::iterator Grams::Find(Grams::Posting& posting, std::uint32_t value)
+{
+    return std::lower_bound(posting.begin(), posting.end(), value, [](const Block& block, std::uint32_t bound)
+    {
+        return block.last < bound;
+    });
+}
+
+//
+// Methods
+//
+
+void Grams::Insert(std::uint32_t trigram, std::uint32_t value)
+{
+    Posting& posting = this->postings[trigram];
+
+    // The highest value yet; only appended, to a new block once the last is full.
+    if (posting.empty() || value > posting.back().last)
+    {
+        if (posting.empty() || posting.back().size == capacity)
+        {
+            posting.emplace_back();
+        }
+
+        this->bytes -= posting.back().bytes.size();
+        Append(posting.back(), value);
+        this->bytes += posting.back().bytes.size();
+
+        return;
+    }
+
+    const Posting::iterator block = Find(posting, value);
+
+    // Walk to the first value of the block at least as high; as high as its last, at the latest.
+    std::size_t offset = 0;
+    std::size_t end = 0;
+    std::uint32_t previous = 0;
+    std::uint32_t current = 0;
+
+    while (true)
+    {
+        std::uint32_t gap;
+        end = Read(block->bytes, offset, gap);
+        current = previous + gap;
+
+        if (current >= value)
+        {
+            break;
+        }
+
+        previous = current;
+        offset = end;
+    }
+
+    // Already indexed.
+    if (current == value)
+    {
+        return;
+    }
+
+    // Its gap is split in two around the value; nothing else in the block changes.
+    std::uint8_t encoded[10];
+    std::size_t length = Varint(value - previous, encoded);
+    length += Varint(current - value, encoded + length);
+
+    this->bytes -= block->bytes.size();
+
+    block->bytes.erase(block->bytes.begin() + static_cast<std::ptrdiff_t>(offset), block->bytes.begin() + static_cast<std::ptrdiff_t>(end));
+    block->bytes.insert(block->bytes.begin() + static_cast<std::ptrdiff_t>(offset), encoded, encoded + length);
+    block->size++;
+
+    // Full; split in two, so the next insert into either half is as cheap.
+    if (block->size > capacity)
+    {
+        std::vector<std::uint32_t> values;
+        values.reserve(block->size);
+        Decode(*block, values);
+
+        const auto middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+        const Posting::iterator upper = posting.insert(std::next(block), Block());
+        const Posting::iterator lower = std::prev(upper);
+
+        Encode(*lower, values.begin(), middle);
+        Encode(*upper, middle, values.end());
+
+        this->bytes += lower->bytes.size() + upper->bytes.size();
+    }
+
+    else
+    {
+        this->bytes += block->bytes.size();
+    }
+}
+
+void Grams::Erase(std::uint32_t trigram, std::uint32_t value)
+{
+    const auto found = this->postings.find(trigram);
+
+    if (found == this->postings.end())
+    {
+        return;
+    }
+
+    Posting& posting = found->second;
+    const Posting::iterator block = Find(posting, value);
+
+    // Higher than every value of the list.
+    if (block == posting.end())
+    {
+        return;
+    }
+
+    // Walk to the first value of the block at least as high; as high as its last, at the latest.
+    std::size_t offset = 0;
+    std::size_t end = 0;
+    std::uint32_t previous = 0;
+    std::uint32_t current = 0;
+
+    while (true)
+    {
+        std::uint32_t gap;
+        end = Read(block->bytes, offset, gap);
+        current = previous + gap;
+
+        if (current >= value)
+        {
+            break;
+        }
+
+        previous = current;
+        offset = end;
+    }
+
+    // Not indexed.
+    if (current != value)
+    {
+        return;
+    }
+
+    this->bytes -= block->bytes.size();
+
+    // The value's gap and the next one's merge into one; nothing else in the block changes.
+    if (end < block->bytes.size())
+    {
+        std::uint32_t gap;
+        end = Read(block->bytes, end, gap);
+
+        std::uint8_t encoded[5];
+        const std::size_t length = Varint(current - previous + gap, encoded);
+
+        block->bytes.erase(block->bytes.begin() + static_cast<std::ptrdiff_t>(offset), block->bytes.begin() + static_cast<std::ptrdiff_t>(end));
+        block->bytes.insert(block->bytes.begin() + static_cast<std::ptrdiff_t>(offset), encoded, encoded + length);
+    }
+
+    // The last value; the previous one becomes the last.
+    else
+    {
+        block->bytes.erase(block->bytes.begin() + static_cast<std::ptrdiff_t>(offset), block->bytes.end());
+        block->last = previous;
+    }
+
+    block->size--;
+
+    if (block->size)
+    {
+        this->bytes += block->bytes.size();
+    }
+
+    else if (posting.size() > 1)
+    {
+        posting.erase(block);
+    }
+
+    else
+    {
+        this->postings.erase(found);
+    }
+}
+
+void Grams::Fill(const Node* root)
+{
+    // Base case.
+    if (!root)
+    {
+        return;
+    }
+
+    Fill(root->nodeL);
+
+    const std::uint32_t value = static_cast<std::uint32_t>(root->value);
+
+    for (const std::uint32_t trigram : Trigrams(Intern::Get(root->label)))
+    {
+        Insert(trigram, value);
+    }
+
+    this->labels[value] = root->label;
+
+    Fill(root->nodeR);
+}
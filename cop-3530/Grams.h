@@ -0,0 +1,276 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_GRAMS_H
+#define PROJECT_1_GRAMS_H
+
+// std...
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// custom...
+#include "Intern.h"
+#include "Node.h"
+
+/**
+ * @class Grams
+ *
+ * @brief Represents an inverted index of the trigrams of the labels of a tree, so the labels closest
+ * to a misspelled one are found among the few sharing some of its trigrams, rather than among all.
+ *
+ * Every label is folded to lowercase and padded, two spaces in front and one behind, so its first and
+ * last letters start and end trigrams of their own; "bob" has "  b", " bo", "bob" and "ob ". Each
+ * trigram has a posting list of the values whose label has it, sorted, in blocks of at most `capacity`
+ * values, each compressed on its own: its first value, then the gap to each next one, as varints.
+ * Values inserted in increasing order only append to the last block. Any other value, and any value
+ * removed, only rewrites the gaps around it, within the block it falls in, which is split in two once
+ * full; a write never costs more than a block per trigram, however long the list.
+ *
+ * A search counts, across the posting lists of the trigrams of the label searched for, how many each
+ * value is in, and ranks those values by the edit distance from their label, most shared trigrams
+ * first. As every edit removes at most 3 of the label's trigrams, a value sharing s of its t trigrams
+ * is at least (t - s) / 3 edits away, so ranking stops once no value left can be closer than the
+ * farthest one kept. Labels sharing none of its trigrams are never considered.
+ */
+class Grams
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs an empty index.
+     *
+     * Time complexity: O(1)
+     */
+    Grams() = default;
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Indexes the given value under the trigrams of the given label.
+     *
+     * Time complexity: O(l * (b + log(p))) where l is the length of the label, b the capacity of a
+     * block, and p the length of the longest posting list it's inserted in; O(l) when the value is
+     * the highest of each.
+     */
+    void Add(const Node::Label& label, std::uint32_t value);
+
+    /**
+     * @brief Removes the given value, if indexed.
+     *
+     * Time complexity: O(l * (b + log(p))) where l is the length of its label, b the capacity of a
+     * block, and p the length of the longest posting list it's removed from.
+     */
+    void Remove(std::uint32_t value);
+
+    /**
+     * @brief Searches for the k values whose label is the fewest edits away from the given label,
+     * ignoring case. If any are found, they're printed ordered by their number of edits, then by
+     * value, and left-padded with zeroes. Otherwise, "unsuccessful" is printed.
+     *
+     * Time complexity: O(p + c * l * m) where p is the total length of the posting lists of the
+     * label's trigrams, c the number of candidates ranked, and l and m the lengths of the labels.
+     */
+    void Search(const Node::Label& label, std::size_t k) const;
+
+    /**
+     * @brief Empties the index, then indexes every node of the tree rooted at the given node.
+     *
+     * Time complexity: O(n * l) where n is the number of nodes in the `root` tree and l the length
+     * of the longest label, as the values are indexed in increasing order.
+     */
+    void Rebuild(const Node* root);
+
+    /**
+     * @brief Returns the number of values indexed.
+     *
+     * Time complexity: O(1)
+     */
+    std::size_t Size() const;
+
+    /**
+     * @brief Returns the number of distinct trigrams indexed.
+     *
+     * Time complexity: O(1)
+     */
+    std::size_t Count() const;
+
+    /**
+     * @brief Returns the number of bytes of the compressed posting lists.
+     *
+     * Time complexity: O(1)
+     */
+    std::size_t Bytes() const;
+
+private:
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the most values a block holds; a fuller one is split in two.
+     */
+    static constexpr std::uint32_t capacity = 128;
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Block
+     * @brief Represents a compressed, sorted run of at most `capacity` values of a posting list.
+     */
+    struct Block
+    {
+        /**
+         * @brief Represents the first value, then the gap to each next one, as varints.
+         */
+        std::vector<std::uint8_t> bytes;
+
+        /**
+         * @brief Represents the highest value.
+         */
+        std::uint32_t last = 0;
+
+        /**
+         * @brief Represents the number of values.
+         */
+        std::uint32_t size = 0;
+    };
+
+    //
+    // Typedefs
+    //
+
+    /**
+     * @typedef Posting
+     * @brief Represents the sorted list of the values whose label has a trigram, as blocks in order.
+     */
+    using Posting = std::vector<Block>;
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Returns the distinct trigrams of the given label, folded and padded, each packed into
+     * the low 3 bytes of an integer, in order.
+     *
+     * Time complexity: O(l * log(l)) where l is the length of the label.
+     */
+    static std::vector<std::uint32_t> Trigrams(const Node::Label& label);
+
+    /**
+     * @brief Returns the number of single-letter insertions, deletions and substitutions turning
+     * one label into the other, ignoring case.
+     *
+     * Time complexity: O(l * m) where l and m are the lengths of the labels.
+     */
+    static std::size_t Distance(const std::string& a, const std::string& b);
+
+    /**
+     * @brief Appends the given value, higher than every other, to the given block.
+     *
+     * Time complexity: O(1)
+     */
+    static void Append(Block& block, std::uint32_t value);
+
+    /**
+     * @brief Appends the values of the given block to the given output, in order.
+     *
+     * Time complexity: O(b) where b is the number of values of the block.
+     */
+    static void Decode(const Block& block, std::vector<std::uint32_t>& output);
+
+    /**
+     * @brief Empties the given block, then appends the given values to it, in order.
+     *
+     * Time complexity: O(b) where b is the number of values.
+     */
+    static void Encode(Block& block, std::vector<std::uint32_t>::const_iterator first, std::vector<std::uint32_t>::const_iterator last);
+
+    /**
+     * @brief Writes the given gap as a varint to the given output, which must fit 5 bytes.
+     *
+     * @return The number of bytes written.
+     *
+     * Time complexity: O(1)
+     */
+    static std::size_t Varint(std::uint32_t gap, std::uint8_t* output);
+
+    /**
+     * @brief Reads the varint starting at the given offset of the given bytes into the given gap.
+     *
+     * @return The offset right past the varint.
+     *
+     * Time complexity: O(1)
+     */
+    static std::size_t Read(const std::vector<std::uint8_t>& bytes, std::size_t offset, std::uint32_t& gap);
+
+    /**
+     * @brief Returns the block of the given posting list the given value falls in: the first whose
+     * highest value is at least as high, or the end if there's none.
+     *
+     * Time complexity: O(log(p)) where p is the length of the posting list.
+     */
+    static Posting::iterator Find(Posting& posting, std::uint32_t value);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Inserts the given value into the posting list of the given trigram.
+     *
+     * Time complexity: O(b + log(p)) where b is the capacity of a block and p the length of the
+     * posting list; O(1) when the value is the highest of it.
+     */
+    void Insert(std::uint32_t trigram, std::uint32_t value);
+
+    /**
+     * @brief Erases the given value from the posting list of the given trigram, the block it was in
+     * once empty, and the list itself once empty.
+     *
+     * Time complexity: O(b + log(p)) where b is the capacity of a block and p the length of the
+     * posting list.
+     */
+    void Erase(std::uint32_t trigram, std::uint32_t value);
+
+    /**
+     * @brief Indexes every node of the tree rooted at the given node, in order.
+     *
+     * Time complexity: O(n * l) where n is the number of nodes in the `root` tree and l the length
+     * of the longest label.
+     */
+    void Fill(const Node* root);
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the posting list of each trigram.
+     */
+    std::unordered_map<std::uint32_t, Posting> postings;
+
+    /**
+     * @brief Represents the interned label of each value, so it's removed from the right lists.
+     */
+    std::unordered_map<std::uint32_t, Intern::Handle> labels;
+
+    /**
+     * @brief Represents the number of bytes of the posting lists.
+     */
+    std::size_t bytes = 0;
+};
+
+#endif //PROJECT_1_GRAMS_H
@@ -0,0 +1,42 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_HASH_H
+#define PROJECT_1_HASH_H
+
+// std...
+#include <cstdint>
+
+/**
+ * @class Hash
+ *
+ * @brief Implements the hash shared by the filters and tables keyed by value: the finalizer of
+ * SplitMix64, which spreads neighbouring values far apart across all 64 bits.
+ *
+ * Defined in the header, so every probe inlines it.
+ */
+class Hash
+{
+public:
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Mixes the bits of the given value, so neighbouring values hash far apart.
+     *
+     * Time complexity: O(1)
+     */
+    static std::uint64_t Mix(std::uint32_t value)
+    {
+        std::uint64_t hash = value + 0x9e3779b97f4a7c15ULL;
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+
+        return hash ^ (hash >> 31);
+    }
+};
+
+#endif //PROJECT_1_HASH_H
@@ -0,0 +1,298 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+
+// custom...
+#include "Hot.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Hot::Hot(std::size_t capacity) : parts(new Segment[segments]), sets(1), hits(0), misses(0), rejections(0)
+{
+    const std::size_t entries = (capacity + segments - 1) / segments;
+
+    while (this->sets * ways < entries)
+    {
+        this->sets *= 2;
+    }
+
+    // Twice as many counters per row as entries, so the hot values rarely share all their counters.
+    this->width = 2 * this->sets * ways;
+
+    for (std::size_t i = 0; i < segments; i++)
+    {
+        this->parts[i].entries.resize(this->sets * ways);
+        this->parts[i].counters.assign(rows * this->width, 0);
+    }
+}
+
+//
+// Methods
+//
+
+bool Hot::Search(const Tree& latest, const Node* root, const Frozen* frozen, const Node::Value& value)
+{
+    // Beyond 32 bits; never stored.
+    if (value >> 32)
+    {
+        Node::PrintFailure();
+
+        return false;
+    }
+
+    const std::uint32_t key = static_cast<std::uint32_t>(value);
+    const std::uint64_t hash = Hash::Mix(key);
+    Segment& segment = this->parts[hash >> 60];
+
+    Intern::Handle label = 0;
+    bool cached = false;
+
+    {
+        std::lock_guard<std::mutex> guard(segment.lock);
+
+        Count(segment, hash);
+
+        const Entry* set = Set(segment, hash);
+        for (std::size_t i = 0; i < ways && !cached; i++)
+        {
+            if (set[i].used && set[i].value == key)
+            {
+                label = set[i].label;
+                cached = true;
+            }
+        }
+    }
+
+    // Cached; successful search!
+    if (cached)
+    {
+        this->hits++;
+        Node::Print(Intern::Get(label));
+
+        return true;
+    }
+
+    this->misses++;
+
+    bool found;
+
+    // The frozen copy is laid out for lookups; the tree is only searched without one.
+    if (frozen)
+    {
+        found = frozen->Find(value, label);
+    }
+
+    else
+    {
+        const Node* node = Node::Find(root, value);
+
+        found = (node != nullptr);
+        label = found ? node->label : label;
+    }
+
+    // No such value; unsuccessful search!
+    if (!found)
+    {
+        Node::PrintFailure();
+
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(segment.lock);
+
+        Entry* set = Set(segment, hash);
+        Entry* victim = set;
+        bool present = false;
+
+        // Pick an unused entry, or else the least searched value of the set.
+        for (std::size_t i = 0; i < ways && !present; i++)
+        {
+            // Already cached by another reader.
+            if (set[i].used && set[i].value == key)
+            {
+                present = true;
+            }
+
+            else if (!set[i].used)
+            {
+                victim = victim->used ? set + i : victim;
+            }
+
+            else if (victim->used && Estimate(segment, Hash::Mix(set[i].value)) < Estimate(segment, Hash::Mix(victim->value)))
+            {
+                victim = set + i;
+            }
+        }
+
+        // Only cache what a tree still in use holds; a writer may have replaced it, and removed the value since.
+        if (!present && latest.Root() == root)
+        {
+            // Admit the value over the least searched value of its set only if it's searched more often.
+            if (victim->used && Estimate(segment, hash) <= Estimate(segment, Hash::Mix(victim->value)))
+            {
+                this->rejections++;
+            }
+
+            else
+            {
+                segment.size += !victim->used;
+
+                victim->value = key;
+                victim->used = true;
+                victim->label = label;
+            }
+        }
+    }
+
+    // Found the matching value; successful search!
+    Node::Print(Intern::Get(label));
+
+    return true;
+}
+
+void Hot::Forget(std::uint32_t value)
+{
+    this->forgotten.push_back(value);
+}
+
+void Hot::Forget()
+{
+    this->everything = true;
+}
+
+void Hot::Flush()
+{
+    if (this->everything)
+    {
+        for (std::size_t i = 0; i < segments; i++)
+        {
+            std::lock_guard<std::mutex> guard(this->parts[i].lock);
+
+            for (Entry& entry : this->parts[i].entries)
+            {
+                entry.used = false;
+            }
+
+            this->parts[i].size = 0;
+        }
+    }
+
+    else
+    {
+        for (const std::uint32_t value : this->forgotten)
+        {
+            const std::uint64_t hash = Hash::Mix(value);
+            Segment& segment = this->parts[hash >> 60];
+
+            std::lock_guard<std::mutex> guard(segment.lock);
+
+            Entry* set = Set(segment, hash);
+            for (std::size_t i = 0; i < ways; i++)
+            {
+                if (set[i].used && set[i].value == value)
+                {
+                    set[i].used = false;
+                    segment.size--;
+                }
+            }
+        }
+    }
+
+    this->forgotten.clear();
+    this->everything = false;
+}
+
+std::string Hot::Stats() const
+{
+    std::size_t size = 0;
+
+    for (std::size_t i = 0; i < segments; i++)
+    {
+        std::lock_guard<std::mutex> guard(this->parts[i].lock);
+
+        size += this->parts[i].size;
+    }
+
+    return std::to_string(size) + " of " + std::to_string(segments * this->sets * ways) + " ids, "
+        + std::to_string(this->hits.load()) + " hits, "
+        + std::to_string(this->misses.load()) + " misses, "
+        + std::to_string(this->rejections.load()) + " rejected";
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr std::size_t Hot::segments;
+
+constexpr std::size_t Hot::ways;
+
+constexpr std::size_t Hot::rows;
+
+constexpr std::uint8_t Hot::saturated;
+
+//
+// Methods
+//
+
+void Hot::Count(Segment& segment, std::uint64_t hash) const
+{
+    // The lower half of the hash picks a counter per row, by double hashing; the upper half, the segment and set.
+    const std::uint32_t first = static_cast<std::uint32_t>(hash);
+    const std::uint32_t step = (first >> 16) | 1;
+
+    for (std::size_t row = 0; row < rows; row++)
+    {
+        std::uint8_t& counter = segment.counters[row * this->width + ((first + row * step) & (this->width - 1))];
+
+        counter += counter < saturated;
+    }
+
+    // Halve every counter every ten searches per entry, so values once hot but no longer are evicted in time.
+    if (++segment.counted >= 10 * segment.entries.size())
+    {
+        for (std::uint8_t& counter : segment.counters)
+        {
+            counter >>= 1;
+        }
+
+        segment.counted /= 2;
+    }
+}
+
+std::uint8_t Hot::Estimate(const Segment& segment, std::uint64_t hash) const
+{
+    const std::uint32_t first = static_cast<std::uint32_t>(hash);
+    const std::uint32_t step = (first >> 16) | 1;
+
+    std::uint8_t estimate = saturated;
+
+    // Every counter overcounts, by the values sharing it; the least overcounts the least.
+    for (std::size_t row = 0; row < rows; row++)
+    {
+        estimate = std::min(estimate, segment.counters[row * this->width + ((first + row * step) & (this->width - 1))]);
+    }
+
+    return estimate;
+}
+
+Hot::Entry* Hot::Set(Segment& segment, std::uint64_t hash) const
+{
+    return segment.entries.data() + ((hash >> 32) & (this->sets - 1)) * ways;
+}
@@ -0,0 +1,252 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_HOT_H
+#define PROJECT_1_HOT_H
+
+// std...
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// custom...
+#include "Frozen.h"
+#include "Hash.h"
+#include "Node.h"
+#include "Tree.h"
+
+/**
+ * @class Hot
+ *
+ * @brief Represents a fixed-size cache of the labels of the most frequently searched values of a
+ * tree, in front of its frozen copy, if any, and `Node::Search`.
+ *
+ * The cache is split into segments by hash, each behind its own lock, and each segment into sets of
+ * eight entries; a value may only be cached in its own set. Admission follows TinyLFU: every search
+ * counts its value in a count-min sketch of small saturating counters, which are halved once the
+ * segment has counted ten searches per entry, so old popularity fades. A value found in the tree
+ * only replaces the least frequently searched value of its set if it's searched more often, so a
+ * burst of one-off searches never flushes out the hot values.
+ *
+ * Writers must tell the cache which values they removed, with `Forget`, and `Flush` it only once the
+ * new tree is the one readers load. A search only caches what it found if the tree it searched is
+ * still the latest, checked under the same lock `Flush` takes, so a slow reader of a replaced tree
+ * never caches a value a writer has since removed.
+ */
+class Hot
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs an empty cache.
+     *
+     * @param capacity The number of values to be cached, at least.
+     *
+     * Time complexity: O(c) where c is the capacity.
+     */
+    explicit Hot(std::size_t capacity);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Searches for the given value, in the cache, then in the given frozen copy, if any, and
+     * otherwise in the tree rooted at the given node. If found, its label is printed. Otherwise,
+     * "unsuccessful" is printed. See `Node::Search`.
+     *
+     * @param latest The tree readers currently load.
+     * @param root The root of the tree to be searched.
+     * @param frozen The frozen copy of the tree, if any, loaded after `root`; searched in its place.
+     * @param value The value to be searched for.
+     *
+     * @return `true` if the value was found, `false` otherwise.
+     *
+     * Time complexity: O(1) if cached, O(log n) otherwise where n is the number of nodes in the `root` tree.
+     */
+    bool Search(const Tree& latest, const Node* root, const Frozen* frozen, const Node::Value& value);
+
+    /**
+     * @brief Marks the given value to be dropped from the cache on the next `Flush`. Only writers may call it.
+     *
+     * Time complexity: O(1)
+     */
+    void Forget(std::uint32_t value);
+
+    /**
+     * @brief Marks every value to be dropped from the cache on the next `Flush`. Only writers may call it.
+     *
+     * Time complexity: O(1)
+     */
+    void Forget();
+
+    /**
+     * @brief Drops the values marked by `Forget`. Only writers may call it, once readers load the new tree.
+     *
+     * Time complexity: O(m) where m is the number of values marked, or the capacity if all were.
+     */
+    void Flush();
+
+    /**
+     * @brief Returns the statistics of the cache, as a single line.
+     *
+     * Time complexity: O(s) where s is the number of segments.
+     */
+    std::string Stats() const;
+
+private:
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the number of segments.
+     */
+    static constexpr std::size_t segments = 16;
+
+    /**
+     * @brief Represents the number of entries of a set.
+     */
+    static constexpr std::size_t ways = 8;
+
+    /**
+     * @brief Represents the number of rows of a count-min sketch.
+     */
+    static constexpr std::size_t rows = 4;
+
+    /**
+     * @brief Represents the highest count of a counter.
+     */
+    static constexpr std::uint8_t saturated = 15;
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Entry
+     * @brief Represents a cached value and its label.
+     */
+    struct Entry
+    {
+        std::uint32_t value = 0;
+
+        bool used = false;
+
+        Intern::Handle label = 0;
+    };
+
+    /**
+     * @struct Segment
+     * @brief Represents the sets, and the sketch, of the values hashing to the same segment.
+     */
+    struct Segment
+    {
+        /**
+         * @brief Guards every other property.
+         */
+        std::mutex lock;
+
+        /**
+         * @brief The entries, set after set.
+         */
+        std::vector<Entry> entries;
+
+        /**
+         * @brief The counters of the sketch, row after row.
+         */
+        std::vector<std::uint8_t> counters;
+
+        /**
+         * @brief The number of searches counted since the counters were last halved.
+         */
+        std::size_t counted = 0;
+
+        /**
+         * @brief The number of entries in use.
+         */
+        std::size_t size = 0;
+    };
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Counts a search for the value of the given hash in the segment's sketch, halving every
+     * counter once enough were counted. The caller must hold the segment's lock.
+     *
+     * Time complexity: O(1) amortized.
+     */
+    void Count(Segment& segment, std::uint64_t hash) const;
+
+    /**
+     * @brief Returns how often the value of the given hash was searched, at least, per the segment's
+     * sketch. The caller must hold the segment's lock.
+     *
+     * Time complexity: O(1)
+     */
+    std::uint8_t Estimate(const Segment& segment, std::uint64_t hash) const;
+
+    /**
+     * @brief Returns the first entry of the set the value of the given hash falls in.
+     *
+     * Time complexity: O(1)
+     */
+    Entry* Set(Segment& segment, std::uint64_t hash) const;
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the segments.
+     */
+    std::unique_ptr<Segment[]> parts;
+
+    /**
+     * @brief Represents the number of sets of each segment, a power of two.
+     */
+    std::size_t sets;
+
+    /**
+     * @brief Represents the number of counters of each row of a sketch, a power of two.
+     */
+    std::size_t width;
+
+    /**
+     * @brief Represents the values marked by `Forget`.
+     */
+    std::vector<std::uint32_t> forgotten;
+
+    /**
+     * @brief Whether every value was marked by `Forget`.
+     */
+    bool everything = false;
+
+    /**
+     * @brief Represents the number of searches answered by the cache.
+     */
+    std::atomic<unsigned long long> hits;
+
+    /**
+     * @brief Represents the number of searches passed on to the tree.
+     */
+    std::atomic<unsigned long long> misses;
+
+    /**
+     * @brief Represents the number of values found in the tree but not admitted.
+     */
+    std::atomic<unsigned long long> rejections;
+};
+
+#endif //PROJECT_1_HOT_H
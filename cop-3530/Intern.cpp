@@ -0,0 +1,316 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <cstring>
+#include <mutex>
+
+// custom...
+#include "Intern.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Static Methods
+//
+
+Intern::Handle Intern::Add(const std::string& label)
+{
+    std::string entry;
+    Encode(label, entry);
+
+    {
+        std::shared_lock<std::shared_timed_mutex> guard(Intern::lock);
+
+        const auto found = Intern::handles.find(entry.data());
+
+        // Already interned; most labels are.
+        if (found != Intern::handles.end())
+        {
+            return found->second;
+        }
+    }
+
+    std::unique_lock<std::shared_timed_mutex> guard(Intern::lock);
+
+    const auto found = Intern::handles.find(entry.data());
+
+    // Interned by another writer meanwhile.
+    if (found != Intern::handles.end())
+    {
+        return found->second;
+    }
+
+    const Handle handle = static_cast<Handle>(Intern::handles.size());
+    const std::size_t block = Block(handle);
+
+    if (!Intern::table[block])
+    {
+        Intern::table[block].reset(new const char*[std::size_t(1) << block]);
+    }
+
+    Store(handle, entry);
+
+    return handle;
+}
+
+bool Intern::Find(const std::string& label, Intern::Handle& handle)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(Intern::lock);
+
+    // Compared by their stored bytes, so the label is compressed rather than every candidate decompressed.
+    std::string entry;
+    Encode(label, entry);
+
+    const auto found = Intern::handles.find(entry.data());
+
+    if (found == Intern::handles.end())
+    {
+        return false;
+    }
+
+    handle = found->second;
+
+    return true;
+}
+
+std::string Intern::Get(Intern::Handle handle)
+{
+    std::string label;
+    Append(handle, label);
+
+    return label;
+}
+
+void Intern::Append(Intern::Handle handle, std::string& output)
+{
+    const std::size_t block = Block(handle);
+
+    std::size_t size;
+    const char* bytes = Bytes(Intern::table[block][handle + 1 - (std::size_t(1) << block)], size);
+
+    if (Intern::symbols)
+    {
+        Intern::symbols->Decode(bytes, size, output);
+    }
+
+    else
+    {
+        output.append(bytes, size);
+    }
+}
+
+void Intern::Train()
+{
+    std::unique_lock<std::shared_timed_mutex> guard(Intern::lock);
+
+    const std::size_t n = Intern::handles.size();
+
+    std::vector<std::string> labels(n);
+    std::size_t total = 0;
+
+    for (Handle handle = 0; handle < n; handle++)
+    {
+        Append(handle, labels[handle]);
+
+        total += labels[handle].size();
+    }
+
+    // Train on every label, or on ones spread evenly across the pool if there are too many bytes of them.
+    const std::size_t stride = total / sample + 1;
+
+    std::vector<std::string> sampled;
+    for (std::size_t i = 0; i < n; i += stride)
+    {
+        sampled.push_back(labels[i]);
+    }
+
+    Intern::symbols.reset(new Symbols(sampled));
+
+    // Start a new arena; the handles keep their numbers.
+    Intern::handles.clear();
+    Intern::chunks.clear();
+    Intern::cursor = nullptr;
+    Intern::remaining = 0;
+    Intern::stored = 0;
+
+    std::string entry;
+    for (Handle handle = 0; handle < n; handle++)
+    {
+        entry.clear();
+        Encode(labels[handle], entry);
+
+        Store(handle, entry);
+    }
+}
+
+std::string Intern::Stats()
+{
+    std::shared_lock<std::shared_timed_mutex> guard(Intern::lock);
+
+    std::string stats = std::to_string(Intern::handles.size()) + " labels, "
+        + std::to_string(Intern::stored) + " bytes";
+
+    if (Intern::symbols)
+    {
+        stats += ", " + std::to_string(Intern::symbols->Size()) + " symbols";
+    }
+
+    return stats;
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr std::size_t Intern::chunk;
+
+constexpr std::size_t Intern::blocks;
+
+constexpr std::size_t Intern::sample;
+
+std::shared_timed_mutex Intern::lock;
+
+std::unordered_map<const char*, Intern::Handle, Intern::Hasher, Intern::Equal> Intern::handles;
+
+std::vector<std::unique_ptr<char[]>> Intern::chunks;
+
+char* Intern::cursor = nullptr;
+
+std::size_t Intern::remaining = 0;
+
+std::size_t Intern::stored = 0;
+
+std::unique_ptr<const Symbols> Intern::symbols;
+
+std::unique_ptr<const char*[]> Intern::table[Intern::blocks];
+
+//
+// Static Methods
+//
+
+std::size_t Intern::Block(Intern::Handle handle)
+{
+    // Block `b` holds the handles from `2^b - 1` up to `2^(b + 1) - 2`.
+    return static_cast<std::size_t>(31 - __builtin_clz(static_cast<std::uint32_t>(handle + 1)));
+}
+
+void Intern::Encode(const std::string& label, std::string& entry)
+{
+    std::string bytes;
+
+    if (Intern::symbols)
+    {
+        Intern::symbols->Encode(label, bytes);
+    }
+
+    else
+    {
+        bytes = label;
+    }
+
+    // The length as a varint, seven bits per byte.
+    std::size_t size = bytes.size();
+
+    do
+    {
+        entry.push_back(static_cast<char>((size & 0x7F) | (size > 0x7F ? 0x80 : 0)));
+        size >>= 7;
+    }
+    while (size);
+
+    entry.append(bytes);
+}
+
+const char* Intern::Bytes(const char* entry, std::size_t& size)
+{
+    size = 0;
+
+    for (int shift = 0; ; shift += 7)
+    {
+        const std::uint8_t byte = static_cast<std::uint8_t>(*entry++);
+
+        size |= static_cast<std::size_t>(byte & 0x7F) << shift;
+
+        if (!(byte & 0x80))
+        {
+            return entry;
+        }
+    }
+}
+
+void Intern::Store(Intern::Handle handle, const std::string& entry)
+{
+    char* copy;
+
+    // Too long for a chunk; give it its own.
+    if (entry.size() > chunk)
+    {
+        Intern::chunks.emplace_back(new char[entry.size()]);
+
+        copy = Intern::chunks.back().get();
+    }
+
+    else
+    {
+        // Out of room; start a new chunk, leaving the rest of the last one unused.
+        if (entry.size() > Intern::remaining)
+        {
+            Intern::chunks.emplace_back(new char[chunk]);
+
+            Intern::cursor = Intern::chunks.back().get();
+            Intern::remaining = chunk;
+        }
+
+        copy = Intern::cursor;
+
+        Intern::cursor += entry.size();
+        Intern::remaining -= entry.size();
+    }
+
+    std::memcpy(copy, entry.data(), entry.size());
+
+    const std::size_t block = Block(handle);
+
+    Intern::table[block][handle + 1 - (std::size_t(1) << block)] = copy;
+    Intern::handles.emplace(copy, handle);
+    Intern::stored += entry.size();
+}
+
+//
+// Structs
+//
+
+std::size_t Intern::Hasher::operator()(const char* entry) const
+{
+    std::size_t size;
+    const char* bytes = Bytes(entry, size);
+
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ static_cast<std::uint8_t>(bytes[i])) * 0x100000001b3ULL;
+    }
+
+    return static_cast<std::size_t>(hash);
+}
+
+bool Intern::Equal::operator()(const char* a, const char* b) const
+{
+    std::size_t sizeA;
+    std::size_t sizeB;
+    const char* bytesA = Bytes(a, sizeA);
+    const char* bytesB = Bytes(b, sizeB);
+
+    return sizeA == sizeB && std::memcmp(bytesA, bytesB, sizeA) == 0;
+}
@@ -0,0 +1,226 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_INTERN_H
+#define PROJECT_1_INTERN_H
+
+// std...
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// custom...
+#include "Symbols.h"
+
+/**
+ * @class Intern
+ *
+ * @brief Implements a pool of interned labels, so that every distinct label is stored once and
+ * referred to by a 4-byte handle; equal labels have equal handles.
+ *
+ * Labels are copied, prefixed by their length, into an arena of 64 KiB chunks, and a handle indexes
+ * the table of their addresses. The table grows in blocks of doubling size, and neither the blocks
+ * nor the chunks ever move or shrink, so a handle resolves without a lock for as long as the program
+ * runs. Labels are thus never freed; the pool only grows by the distinct labels ever interned, and
+ * only shrinks when trained.
+ *
+ * Once trained, the pool stores labels compressed against a table of `Symbols` instead, re-encoding
+ * the ones already interned. Labels are looked up by their compressed bytes, so only `Get` and
+ * `Append` ever decompress them.
+ *
+ * Interning and looking up labels by their text take a lock, shared by lookups; resolving handles
+ * never does.
+ */
+class Intern
+{
+public:
+
+    //
+    // Typedefs
+    //
+
+    /**
+     * @typedef Handle
+     * @brief Represents the handle of an interned label.
+     */
+    using Handle = std::uint32_t;
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Interns the given label, unless it already is.
+     *
+     * @return The handle of the label.
+     *
+     * Time complexity: O(l) on average where l is the length of the label.
+     */
+    static Handle Add(const std::string& label);
+
+    /**
+     * @brief Finds the handle of the given label, without interning it.
+     *
+     * @param label The label to be found.
+     * @param handle Set to the handle of the label, if it's interned.
+     *
+     * @return `true` if the label is interned, `false` otherwise.
+     *
+     * Time complexity: O(l) on average where l is the length of the label.
+     */
+    static bool Find(const std::string& label, Handle& handle);
+
+    /**
+     * @brief Returns the label of the given handle.
+     *
+     * Time complexity: O(l) where l is the length of the label.
+     */
+    static std::string Get(Handle handle);
+
+    /**
+     * @brief Appends the label of the given handle to the given output.
+     *
+     * Time complexity: O(l) where l is the length of the label.
+     */
+    static void Append(Handle handle, std::string& output);
+
+    /**
+     * @brief Trains a table of symbols on the interned labels, then stores every label compressed
+     * against it, freeing the arena they were stored in. Nothing else may use the pool meanwhile,
+     * not even to resolve handles.
+     *
+     * Time complexity: O(b) where b is the number of bytes of the interned labels.
+     */
+    static void Train();
+
+    /**
+     * @brief Returns the statistics of the pool, as a single line: the number of labels interned, the
+     * number of bytes they take in the arena, and the number of symbols, if trained.
+     *
+     * Time complexity: O(1)
+     */
+    static std::string Stats();
+
+private:
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Hasher
+     * @brief Hashes the bytes of a stored label with FNV-1a.
+     */
+    struct Hasher
+    {
+        std::size_t operator()(const char* entry) const;
+    };
+
+    /**
+     * @struct Equal
+     * @brief Compares the bytes of two stored labels.
+     */
+    struct Equal
+    {
+        bool operator()(const char* a, const char* b) const;
+    };
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Returns the block of the table holding the address of the given handle.
+     *
+     * Time complexity: O(1)
+     */
+    static std::size_t Block(Handle handle);
+
+    /**
+     * @brief Sets the given entry to the given label as it's stored: its length, then its bytes,
+     * compressed if trained.
+     *
+     * Time complexity: O(l) where l is the length of the label.
+     */
+    static void Encode(const std::string& label, std::string& entry);
+
+    /**
+     * @brief Returns the bytes of the given stored label, and sets the given size to their number.
+     *
+     * Time complexity: O(1)
+     */
+    static const char* Bytes(const char* entry, std::size_t& size);
+
+    /**
+     * @brief Copies the given entry into the arena, and points the given handle to the copy.
+     *
+     * Time complexity: O(e) where e is the length of the entry.
+     */
+    static void Store(Handle handle, const std::string& entry);
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the number of bytes of a chunk of the arena.
+     */
+    static constexpr std::size_t chunk = 1 << 16;
+
+    /**
+     * @brief Represents the number of blocks of the table; block `b` holds `2^b` addresses.
+     */
+    static constexpr std::size_t blocks = 32;
+
+    /**
+     * @brief Represents the most bytes of labels a table of symbols is trained on.
+     */
+    static constexpr std::size_t sample = 1 << 14;
+
+    /**
+     * @brief Guards every other property but `table` and `symbols`, read without it; only `Train`
+     * changes what they already hold.
+     */
+    static std::shared_timed_mutex lock;
+
+    /**
+     * @brief Represents the handles of the labels, keyed by their entry in the arena.
+     */
+    static std::unordered_map<const char*, Handle, Hasher, Equal> handles;
+
+    /**
+     * @brief Represents the chunks of the arena, along with the labels too long for one.
+     */
+    static std::vector<std::unique_ptr<char[]>> chunks;
+
+    /**
+     * @brief Represents the first unused byte of the last chunk.
+     */
+    static char* cursor;
+
+    /**
+     * @brief Represents the number of unused bytes of the last chunk.
+     */
+    static std::size_t remaining;
+
+    /**
+     * @brief Represents the number of bytes of the arena taken by labels.
+     */
+    static std::size_t stored;
+
+    /**
+     * @brief Represents the table of symbols labels are compressed against, if trained.
+     */
+    static std::unique_ptr<const Symbols> symbols;
+
+    /**
+     * @brief Represents the blocks of the table from the handles to the labels in the arena.
+     */
+    static std::unique_ptr<const char*[]> table[blocks];
+};
+
+#endif //PROJECT_1_INTERN_H
@@ -0,0 +1,181 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <cerrno>
+#include <fstream>
+
+// sys...
+#include <fcntl.h>
+#include <unistd.h>
+
+// custom...
+#include "Journal.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Static Methods
+//
+
+bool Journal::Open(const std::string& path, const std::function<void(const Journal::Record&)>& apply)
+{
+    std::ifstream stream(path, std::ios::binary);
+    std::streamoff complete = 0;
+    std::string line;
+
+    // Read record by record, remembering where the last complete one ends.
+    while (stream && std::getline(stream, line) && !stream.eof())
+    {
+        std::size_t n;
+
+        // Try to convert the header.
+        try
+        {
+            n = std::stoul(line);
+        }
+
+        // Header couldn't be properly converted; the rest is unreadable.
+        catch (...)
+        {
+            break;
+        }
+
+        Record record;
+
+        // A line missing its newline was cut short.
+        while (record.size() < n && std::getline(stream, line) && !stream.eof())
+        {
+            record.push_back(line);
+        }
+
+        if (record.size() < n)
+        {
+            break;
+        }
+
+        complete = stream.tellg();
+
+        apply(record);
+    }
+
+    stream.close();
+
+    std::lock_guard<std::mutex> guard(mutex);
+
+    fd = open(path.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+
+    bool created = false;
+
+    // Missing; create it, failing if another process just did.
+    if (fd < 0 && errno == ENOENT)
+    {
+        fd = open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_APPEND | O_CLOEXEC, 0644);
+        created = (fd >= 0);
+    }
+
+    // A new file is only durable once its directory is, or a crash could lose it along with every record.
+    // Then drop the incomplete tail, so new records follow the last complete one.
+    if (fd < 0 || (created && !Persist(path)) || ftruncate(fd, complete) < 0)
+    {
+        Close();
+
+        return false;
+    }
+
+    return true;
+}
+
+bool Journal::Append(const Journal::Record& record)
+{
+    std::lock_guard<std::mutex> guard(mutex);
+
+    // Not journaling.
+    if (fd < 0)
+    {
+        return true;
+    }
+
+    std::string buffer = std::to_string(record.size()) + "\n";
+    for (const std::string& line : record)
+    {
+        buffer += line + "\n";
+    }
+
+    const off_t end = lseek(fd, 0, SEEK_END);
+    std::size_t written = 0;
+
+    while (written < buffer.size())
+    {
+        const ssize_t size = write(fd, buffer.data() + written, buffer.size() - written);
+
+        if (size >= 0)
+        {
+            written += static_cast<std::size_t>(size);
+        }
+
+        // Take back the part written, so later records don't follow an incomplete one.
+        else if (errno != EINTR)
+        {
+            if (ftruncate(fd, end) < 0)
+            {
+                // Nothing more to be done; replaying stops there.
+            }
+
+            return false;
+        }
+    }
+
+    return fdatasync(fd) == 0;
+}
+
+void Journal::Close()
+{
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    fd = -1;
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+int Journal::fd = -1;
+
+std::mutex Journal::mutex;
+
+//
+// Static Methods
+//
+
+bool Journal::Persist(const std::string& path)
+{
+    const std::size_t slash = path.rfind('/');
+
+    // Relative to the working directory, unless the path names another.
+    const std::string directory = (slash == std::string::npos) ? "." : (slash == 0) ? "/" : path.substr(0, slash);
+
+    const int handle = open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (handle < 0)
+    {
+        return false;
+    }
+
+    const bool flushed = (fsync(handle) == 0);
+
+    close(handle);
+
+    return flushed;
+}
@@ -0,0 +1,114 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_JOURNAL_H
+#define PROJECT_1_JOURNAL_H
+
+// std...
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class Journal
+ *
+ * @brief Implements a write-ahead log of the commands that mutate the trees.
+ *
+ * Every record holds one or more command lines and is appended with a single write, then flushed
+ * to disk before the commands take effect; replaying the records in order rebuilds the trees, as
+ * the commands are deterministic. A record reads as its number of lines, then the lines:
+ *
+ * ```
+ * 2
+ * insert "Ann" 00000010
+ * remove 00000020
+ * ```
+ *
+ * A record cut short by a crash is incomplete, and discarded along with anything after it.
+ */
+class Journal
+{
+public:
+
+    //
+    // Typedefs
+    //
+
+    /**
+     * @typedef Record
+     * @brief Represents the command lines of a single record, applied all together or not at all.
+     * The record is of type `std::vector<std::string>`.
+     */
+    using Record = std::vector<std::string>;
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Replays every complete record of the journal at the given path, discards whatever
+     * follows them, and opens the journal for appending.
+     *
+     * @param path The filesystem path of the journal; created if missing, along with its directory entry
+     * flushed to disk.
+     * @param apply Called with each complete record, in order, before the journal is opened.
+     *
+     * @return `true` if the journal was opened, `false` otherwise.
+     *
+     * Time complexity: O(n) where n is the size of the journal.
+     */
+    static bool Open(const std::string& path, const std::function<void(const Record&)>& apply);
+
+    /**
+     * @brief Appends the given record and flushes it to disk. Does nothing unless a journal is open.
+     *
+     * @param record The command lines to be appended.
+     *
+     * @return `false` if the record couldn't be made durable, `true` otherwise.
+     *
+     * Time complexity: O(n) where n is the size of the record, plus one flush.
+     */
+    static bool Append(const Record& record);
+
+    /**
+     * @brief Closes the journal, if open.
+     *
+     * Time complexity: O(1)
+     */
+    static void Close();
+
+private:
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Flushes the directory holding the given path to disk, making the file's entry in it durable.
+     *
+     * @param path The filesystem path of the file.
+     *
+     * @return `true` if flushed, `false` otherwise.
+     *
+     * Time complexity: O(1), plus one flush.
+     */
+    static bool Persist(const std::string& path);
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the file descriptor of the open journal, or `-1` if none is.
+     */
+    static int fd;
+
+    /**
+     * @brief Guards `fd`, so concurrent records never interleave.
+     */
+    static std::mutex mutex;
+};
+
+#endif //PROJECT_1_JOURNAL_H
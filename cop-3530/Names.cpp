@@ -0,0 +1,134 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <cctype>
+#include <limits>
+
+// custom...
+#include "Intern.h"
+#include "Names.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Methods
+//
+
+void Names::Add(const Node::Label& label, std::uint32_t value)
+{
+    Remove(value);
+
+    this->values.emplace(value, this->entries.emplace(Fold(label), value).first);
+}
+
+void Names::Remove(std::uint32_t value)
+{
+    const auto found = this->values.find(value);
+
+    if (found != this->values.end())
+    {
+        this->entries.erase(found->second);
+        this->values.erase(found);
+    }
+}
+
+void Names::Prefix(const Node::Label& prefix) const
+{
+    const std::string folded = Fold(prefix);
+    const auto first = this->entries.lower_bound(Entry(folded, 0));
+
+    // Every label starting with the prefix sorts right after it, so the run ends at the first that doesn't.
+    const auto last = std::find_if(first, this->entries.end(), [&folded](const Entry& entry)
+    {
+        return entry.first.compare(0, folded.size(), folded) != 0;
+    });
+
+    Print(first, last);
+}
+
+void Names::Search(const Node::Label& label) const
+{
+    const std::string folded = Fold(label);
+
+    Print(this->entries.lower_bound(Entry(folded, 0)),
+          this->entries.upper_bound(Entry(folded, std::numeric_limits<std::uint32_t>::max())));
+}
+
+void Names::Rebuild(const Node* root)
+{
+    this->entries.clear();
+    this->values.clear();
+
+    Fill(root);
+}
+
+std::size_t Names::Size() const
+{
+    return this->values.size();
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Static Methods
+//
+
+std::string Names::Fold(const Node::Label& label)
+{
+    std::string folded = label;
+
+    for (char& letter : folded)
+    {
+        letter = static_cast<char>(std::tolower(static_cast<unsigned char>(letter)));
+    }
+
+    return folded;
+}
+
+//
+// Methods
+//
+
+void Names::Print(std::set<Entry>::const_iterator first, std::set<Entry>::const_iterator last) const
+{
+    std::string result;
+
+    for (auto it = first; it != last; ++it)
+    {
+        result.append(Node::Pad(it->second));
+        result.append("\n");
+    }
+
+    if (!result.empty())
+    {
+        // Print, but remove the last newline insertion.
+        Node::Print(result.substr(0, result.size() - 1));
+    }
+
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void Names::Fill(const Node* root)
+{
+    // Base case.
+    if (!root)
+    {
+        return;
+    }
+
+    Fill(root->nodeL);
+    Add(Intern::Get(root->label), static_cast<std::uint32_t>(root->value));
+    Fill(root->nodeR);
+}
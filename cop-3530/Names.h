@@ -0,0 +1,154 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_NAMES_H
+#define PROJECT_1_NAMES_H
+
+// std...
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+// custom...
+#include "Node.h"
+
+/**
+ * @class Names
+ *
+ * @brief Represents an index of the labels of a tree, sorted case-insensitively, so the IDs of the
+ * nodes whose label starts with, or equals, a given one are found without walking the tree.
+ *
+ * Every node is indexed as a pair of its label, folded to lowercase, and its value, kept in order;
+ * the nodes whose folded label starts with a given prefix are then a single run of pairs, found by
+ * a binary search and read in order. The pair of each value is also kept in a hash table, so a
+ * value is removed without knowing its label.
+ *
+ * The index copies the labels it holds rather than their handles, as interned labels are ordered
+ * by when they were first interned rather than by their text.
+ */
+class Names
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs an empty index.
+     *
+     * Time complexity: O(1)
+     */
+    Names() = default;
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Indexes the given value under the given label.
+     *
+     * Time complexity: O(l + log(n)) where l is the length of the label and n the number of values.
+     */
+    void Add(const Node::Label& label, std::uint32_t value);
+
+    /**
+     * @brief Removes the given value, if indexed.
+     *
+     * Time complexity: O(log(n)) where n is the number of values.
+     */
+    void Remove(std::uint32_t value);
+
+    /**
+     * @brief Searches for the values whose label starts with the given prefix, ignoring case. If
+     * any are found, they're printed, ordered by their label then by value, and left-padded with
+     * zeroes. Otherwise, "unsuccessful" is printed.
+     *
+     * Time complexity: O(p * log(n) + k) where p is the length of the prefix, n the number of values,
+     * and k the number found.
+     */
+    void Prefix(const Node::Label& prefix) const;
+
+    /**
+     * @brief Searches for the values whose label equals the given label, ignoring case. If any are
+     * found, they're printed in order, left-padded with zeroes. Otherwise, "unsuccessful" is printed.
+     *
+     * Time complexity: O(l * log(n) + k) where l is the length of the label, n the number of values,
+     * and k the number found.
+     */
+    void Search(const Node::Label& label) const;
+
+    /**
+     * @brief Empties the index, then indexes every node of the tree rooted at the given node.
+     *
+     * Time complexity: O(n * log(n)) where n is the number of nodes in the `root` tree.
+     */
+    void Rebuild(const Node* root);
+
+    /**
+     * @brief Returns the number of values indexed.
+     *
+     * Time complexity: O(1)
+     */
+    std::size_t Size() const;
+
+private:
+
+    //
+    // Typedefs
+    //
+
+    /**
+     * @typedef Entry
+     * @brief Represents a folded label along with the value indexed under it.
+     */
+    using Entry = std::pair<std::string, std::uint32_t>;
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Returns the given label in lowercase.
+     *
+     * Time complexity: O(l) where l is the length of the label.
+     */
+    static std::string Fold(const Node::Label& label);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Prints the values of the entries from `first` up to `last`, or "unsuccessful" if none.
+     *
+     * Time complexity: O(k) where k is the number of entries.
+     */
+    void Print(std::set<Entry>::const_iterator first, std::set<Entry>::const_iterator last) const;
+
+    /**
+     * @brief Indexes every node of the tree rooted at the given node.
+     *
+     * Time complexity: O(n * log(n)) where n is the number of nodes in the `root` tree.
+     */
+    void Fill(const Node* root);
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the entries, ordered by folded label, then by value.
+     */
+    std::set<Entry> entries;
+
+    /**
+     * @brief Represents the entry of each value.
+     */
+    std::unordered_map<std::uint32_t, std::set<Entry>::const_iterator> values;
+};
+
+#endif //PROJECT_1_NAMES_H
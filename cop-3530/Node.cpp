@@ -17,39 +17,72 @@
 // Construct / Destruct
 //
 
-Node::Node(Node::Value value, Node::Label label)
+Node::Node(Node::Value value, Node::Label label) : Node(value, Intern::Add(label))
 {
-    this->value = value;
-    this->label = std::move(label);
+}
+
+Node::Node(Node::Value value, Intern::Handle label)
+{
+    this->value = static_cast<std::uint32_t>(value);
+    this->label = label;
     this->cache = 1;
+    this->rank = 1;
     this->nodeL = nullptr;
     this->nodeR = nullptr;
 }
 
+Node::Scope::Scope()
+{
+    this->previous = Node::scope;
+
+    Node::scope = this;
+}
+
+Node::Scope::~Scope()
+{
+    Node::scope = this->previous;
+}
+
 //
 // Static Methods
 //
 
 Node* Node::Insert(Node* root, const Node::Value& value, const Node::Label& label)
+{
+    const Node* inserted = nullptr;
+
+    return Insert(root, value, label, inserted);
+}
+
+Node* Node::Insert(Node* root, const Node::Value& value, const Node::Label& label, const Node*& inserted)
 {
     // Empty location found; successful insert!
     if (!root)
     {
         PrintSuccess();
 
-        return new Node(value, label);
+        Node* node = Create(value, label);
+        inserted = node;
+
+        return node;
     }
 
     // Insert to the left subtree...
     else if (root->value > value)
     {
-        root->nodeL = Insert(root->nodeL, value, label);
+        Node* nodeL = Insert(root->nodeL, value, label, inserted);
+
+        root = Own(root);
+        root->nodeL = nodeL;
     }
 
     // Insert to the right subtree...
     else if (root->value < value)
     {
-        root->nodeR = Insert(root->nodeR, value, label);
+        Node* nodeR = Insert(root->nodeR, value, label, inserted);
+
+        root = Own(root);
+        root->nodeR = nodeR;
     }
 
     // Values must be unique; unsuccessful insert!
@@ -64,7 +97,7 @@ Node* Node::Insert(Node* root, const Node::Value& value, const Node::Label& labe
     root->cache = Max(root) + 1;
 
     // Re-balance the tree (if necessary).
-    return Repair(root);
+    return Promote(root);
 }
 
 Node* Node::Remove(Node* root, const Node::Value& value)
@@ -80,13 +113,19 @@ Node* Node::Remove(Node* root, const Node::Value& value)
     // Remove in the left subtree...
     else if (root->value > value)
     {
-        root->nodeL = Remove(root->nodeL, value);
+        Node* nodeL = Remove(root->nodeL, value);
+
+        root = Own(root);
+        root->nodeL = nodeL;
     }
 
     // Remove in the right subtree...
     else if (root->value < value)
     {
-        root->nodeR = Remove(root->nodeR, value);
+        Node* nodeR = Remove(root->nodeR, value);
+
+        root = Own(root);
+        root->nodeR = nodeR;
     }
 
     // Found the node to delete; successful deletion!
@@ -99,19 +138,26 @@ Node* Node::Remove(Node* root, const Node::Value& value)
 
             Node* temp = (root->nodeL) ? root->nodeL : root->nodeR;
 
-            delete root;
+            Release(root);
             return temp;
         }
 
         // Removal for node with 2 children.
         else
         {
-            // Get the in-order successor.
-            Node* temp = Successor(root->nodeR);
+            Node::PrintSuccess();
+
+            // Put the in-order successor in its place, rather than its value, so every node keeps its own.
+            Node* temp = nullptr;
+            Node* nodeR = Detach(root->nodeR, temp);
 
-            root->value = temp->value;
-            root->label = temp->label;
-            root->nodeR = Remove(root->nodeR, temp->value);
+            temp = Own(temp);
+            temp->nodeL = root->nodeL;
+            temp->nodeR = nodeR;
+            temp->rank = root->rank;
+
+            Release(root);
+            root = temp;
         }
     }
 
@@ -119,7 +165,7 @@ Node* Node::Remove(Node* root, const Node::Value& value)
     root->cache = Max(root) + 1;
 
     // Re-balance the tree (if necessary).
-    return Repair(root);
+    return Demote(root);
 }
 
 Node* Node::Remove(Node* root, unsigned int n)
@@ -130,7 +176,7 @@ Node* Node::Remove(Node* root, unsigned int n)
     // Try to remove the node at the n-th position.
     try
     {
-        return Remove(root, nodes.at(n)->value);
+        return Remove(root, static_cast<Value>(nodes.at(n)->value));
     }
 
     // N-th position unobtainable; unsuccessful remove!
@@ -142,37 +188,97 @@ Node* Node::Remove(Node* root, unsigned int n)
     }
 }
 
-void Node::Search(const Node* root, const Node::Value& value)
+void Node::Clear(Node* root)
+{
+    // Base case.
+    if (!root)
+    {
+        return;
+    }
+
+    Clear(root->nodeL);
+    Clear(root->nodeR);
+
+    Release(root);
+}
+
+void Node::Clear(const std::vector<Node*>& nodes)
+{
+    for (Node* node : nodes)
+    {
+        Release(node);
+    }
+}
+
+Node* Node::Copy(const Node* root)
+{
+    // Base case.
+    if (!root)
+    {
+        return nullptr;
+    }
+
+    Node* copy = Create(root->value, root->label);
+    copy->cache = root->cache;
+    copy->rank = root->rank;
+    copy->nodeL = Copy(root->nodeL);
+    copy->nodeR = Copy(root->nodeR);
+
+    return copy;
+}
+
+bool Node::Search(const Node* root, const Node::Value& value)
 {
     // Expected a node; unsuccessful search!
     if (!root)
     {
         PrintFailure();
+
+        return false;
     }
 
     // Found the matching value; successful search!
     else if (root->value == value)
     {
-        Print(root->label);
+        Print(Intern::Get(root->label));
+
+        return true;
     }
 
     // Search to the left subtree...
     else if (root->value > value)
     {
-        Search(root->nodeL, value);
+        return Search(root->nodeL, value);
     }
 
     // Search to the right subtree...
-    else if (root->value < value)
+    else
     {
-        Search(root->nodeR, value);
+        return Search(root->nodeR, value);
     }
 }
 
+const Node* Node::Find(const Node* root, const Node::Value& value)
+{
+    // Descend until the value or an empty location is found.
+    while (root && root->value != value)
+    {
+        root = (root->value > value) ? root->nodeL : root->nodeR;
+    }
+
+    return root;
+}
+
 void Node::Search(const Node* root, const Node::Label& label)
 {
     std::string result;
-    Search(root, label, result);
+    Intern::Handle handle;
+
+    // Never interned; no node has it.
+    if (Intern::Find(label, handle))
+    {
+        Search(root, handle, result);
+    }
 
     if (!result.empty())
     {
@@ -205,22 +311,58 @@ void Node::Print(const Node* root, Node::Order order)
 
 void Node::Print(const Node* node)
 {
-    std::cout << Height(node) << std::endl;
+    *stream << static_cast<unsigned int>(Height(node)) << std::endl;
 }
 
 void Node::Print(const std::string& phrase)
 {
-    std::cout << phrase << std::endl;
+    *stream << phrase << std::endl;
 }
 
 void Node::PrintSuccess()
 {
-    std::cout << "successful" << std::endl;
+    *stream << "successful" << std::endl;
 }
 
 void Node::PrintFailure()
 {
-    std::cout << "unsuccessful" << std::endl;
+    *stream << "unsuccessful" << std::endl;
+}
+
+Node::Label Node::Pad(const Node::Value& value)
+{
+    std::string padded = std::to_string(value);
+
+    if (padded.size() < 8)
+    {
+        return std::string(8 - padded.size(), '0') + padded;
+    }
+
+    else
+    {
+        return padded;
+    }
+}
+
+std::ostream* Node::Redirect(std::ostream* stream)
+{
+    std::ostream* previous = Node::stream;
+    Node::stream = stream;
+
+    return previous;
+}
+
+Node::Balance Node::Rebalance(Node::Balance balance)
+{
+    const Balance previous = Node::balance;
+    Node::balance = balance;
+
+    return previous;
+}
+
+std::size_t Node::Rotations()
+{
+    return rotations.load(std::memory_order_relaxed);
 }
 
 
@@ -228,22 +370,68 @@ void Node::PrintFailure()
 // --- Private ---
 //
 
+//
+// Define Static Properties
+//
+
+thread_local std::ostream* Node::stream = &std::cout;
+
+thread_local Node::Scope* Node::scope = nullptr;
+
+Node::Balance Node::balance = Node::Balance::AVL;
+
+std::atomic<std::size_t> Node::rotations(0);
+
 //
 // Static Methods
 //
 
-Node::Label Node::Pad(const Node* node)
+Node* Node::Create(const Node::Value& value, const Node::Label& label)
+{
+    return Create(value, Intern::Add(label));
+}
+
+Node* Node::Create(const Node::Value& value, Intern::Handle label)
 {
-    std::string padded = std::to_string(node->value);
+    Node* node = new Node(value, label);
 
-    if (padded.size() < 8)
+    if (scope)
     {
-        return std::string(8 - padded.size(), '0') + padded;
+        scope->fresh.insert(node);
+    }
+
+    return node;
+}
+
+Node* Node::Own(Node* node)
+{
+    // Modify in place.
+    if (!scope || !node || scope->fresh.count(node))
+    {
+        return node;
+    }
+
+    // Copy-on-write.
+    Node* copy = new Node(*node);
+
+    scope->fresh.insert(copy);
+    scope->retired.push_back(node);
+
+    return copy;
+}
+
+void Node::Release(Node* node)
+{
+    // Nothing else can see it; free immediately.
+    if (!scope || scope->fresh.erase(node))
+    {
+        delete node;
     }
 
+    // Others may still see it; leave it to the owner of the scope.
     else
     {
-        return padded;
+        scope->retired.push_back(node);
     }
 }
 
@@ -270,18 +458,29 @@ int Node::Factor(Node* node)
     return (node) ? Height(node->nodeL) - Height(node->nodeR) : 0;
 }
 
-Node* Node::Successor(Node* root)
+Node* Node::Detach(Node* root, Node*& min)
 {
-    // *Safely* guarantee there is no node to the left.
-    if (!root || !root->nodeL)
+    // No node to the left; unlink this one.
+    if (!root->nodeL)
     {
-        return root;
+        min = root;
+
+        return root->nodeR;
     }
 
-    return Successor(root->nodeL);
+    Node* nodeL = Detach(root->nodeL, min);
+
+    root = Own(root);
+    root->nodeL = nodeL;
+
+    // Update the cache.
+    root->cache = Max(root) + 1;
+
+    // Re-balance the tree (if necessary).
+    return Demote(root);
 }
 
-void Node::Search(const Node* root, const Node::Label& label, std::string& output)
+void Node::Search(const Node* root, Intern::Handle label, std::string& output)
 {
     if (!root)
     {
@@ -295,7 +494,7 @@ void Node::Search(const Node* root, const Node::Label& label, std::string& outpu
 
     if (root->label == label)
     {
-        output.append(Pad(root));
+        output.append(Pad(root->value));
         output.append("\n");
     }
 
@@ -316,7 +515,8 @@ void Node::Traverse(const Node* root, const Node::Order& order, std::string& out
     // Pre-Order Traversal
     else if (order == Order::NLR)
     {
-        output.append(root->label + ", ");
+        Intern::Append(root->label, output);
+        output.append(", ");
         Traverse(root->nodeL, order, output);
         Traverse(root->nodeR, order, output);
     }
@@ -325,7 +525,8 @@ void Node::Traverse(const Node* root, const Node::Order& order, std::string& out
     else if (order == Order::LNR)
     {
         Traverse(root->nodeL, order, output);
-        output.append(root->label + ", ");
+        Intern::Append(root->label, output);
+        output.append(", ");
         Traverse(root->nodeR, order, output);
     }
 
@@ -334,7 +535,8 @@ void Node::Traverse(const Node* root, const Node::Order& order, std::string& out
     {
         Traverse(root->nodeL, order, output);
         Traverse(root->nodeR, order, output);
-        output.append(root->label + ", ");
+        Intern::Append(root->label, output);
+        output.append(", ");
     }
 }
 
@@ -373,6 +575,9 @@ void Node::Traverse(Node* root, const Node::Order& order, std::vector<Node*>& ou
 
 Node* Node::RotateL(Node* node)
 {
+    node = Own(node);
+    node->nodeR = Own(node->nodeR);
+
     Node* rotateNode = node->nodeR;
     Node* grandchild = node->nodeR->nodeL;
 
@@ -383,11 +588,16 @@ Node* Node::RotateL(Node* node)
     node->cache = Max(node) + 1;
     rotateNode->cache = Max(rotateNode) + 1;
 
+    rotations.fetch_add(1, std::memory_order_relaxed);
+
     return rotateNode;
 }
 
 Node* Node::RotateR(Node* node)
 {
+    node = Own(node);
+    node->nodeL = Own(node->nodeL);
+
     Node* rotateNode = node->nodeL;
     Node* grandchild = node->nodeL->nodeR;
 
@@ -398,6 +608,8 @@ Node* Node::RotateR(Node* node)
     node->cache = Max(node) + 1;
     rotateNode->cache = Max(rotateNode) + 1;
 
+    rotations.fetch_add(1, std::memory_order_relaxed);
+
     return rotateNode;
 }
 
@@ -450,3 +662,184 @@ Node* Node::Repair(Node* root)
     // Just in case.
     return root;
 }
+
+Node::Cache Node::Rank(const Node* node)
+{
+    return (node) ? node->rank : 0;
+}
+
+Node* Node::Promote(Node* root)
+{
+    if (balance == Balance::AVL)
+    {
+        return Repair(root);
+    }
+
+    // A child was created or promoted below to the node's own rank; it's a 0-child.
+    if (Rank(root->nodeL) == root->rank)
+    {
+        // The sibling is a 1-child; promote, which may leave a 0-child for the parent.
+        if (root->rank - Rank(root->nodeR) == 1)
+        {
+            root->rank++;
+
+            return root;
+        }
+
+        // L-L Case
+        if (root->nodeL->rank - Rank(root->nodeL->nodeR) == 2)
+        {
+            root = RotateR(root);
+            root->nodeR->rank--;
+
+            return root;
+        }
+
+        // L-R Case
+        root = RotateLR(root);
+        root->rank++;
+        root->nodeL->rank--;
+        root->nodeR->rank--;
+
+        return root;
+    }
+
+    if (Rank(root->nodeR) == root->rank)
+    {
+        if (root->rank - Rank(root->nodeL) == 1)
+        {
+            root->rank++;
+
+            return root;
+        }
+
+        // R-R Case
+        if (root->nodeR->rank - Rank(root->nodeR->nodeL) == 2)
+        {
+            root = RotateL(root);
+            root->nodeL->rank--;
+
+            return root;
+        }
+
+        // R-L Case
+        root = RotateRL(root);
+        root->rank++;
+        root->nodeL->rank--;
+        root->nodeR->rank--;
+
+        return root;
+    }
+
+    return root;
+}
+
+Node* Node::Demote(Node* root)
+{
+    if (balance == Balance::AVL)
+    {
+        return Repair(root);
+    }
+
+    // A leaf lost its only child; leaves must have rank one.
+    if (!root->nodeL && !root->nodeR && root->rank == 2)
+    {
+        root->rank = 1;
+
+        return root;
+    }
+
+    // A child was removed or demoted below to three ranks under the node; it's a 3-child.
+    if (root->rank - Rank(root->nodeL) == 3)
+    {
+        Node* sibling = root->nodeR;
+
+        // The sibling is a 2-child; demote, which may leave a 3-child for the parent.
+        if (root->rank - sibling->rank == 2)
+        {
+            root->rank--;
+
+            return root;
+        }
+
+        // The sibling is a 2,2 node; demote both, likewise.
+        if (sibling->rank - Rank(sibling->nodeL) == 2 && sibling->rank - Rank(sibling->nodeR) == 2)
+        {
+            root->rank--;
+            root->nodeR = Own(sibling);
+            root->nodeR->rank--;
+
+            return root;
+        }
+
+        // R-R Case
+        if (sibling->rank - Rank(sibling->nodeR) == 1)
+        {
+            root = RotateL(root);
+            root->rank++;
+            root->nodeL->rank--;
+
+            // Leaves must have rank one.
+            if (!root->nodeL->nodeL && !root->nodeL->nodeR)
+            {
+                root->nodeL->rank--;
+            }
+
+            return root;
+        }
+
+        // R-L Case
+        root = RotateRL(root);
+        root->rank += 2;
+        root->nodeL->rank -= 2;
+        root->nodeR->rank--;
+
+        return root;
+    }
+
+    if (root->rank - Rank(root->nodeR) == 3)
+    {
+        Node* sibling = root->nodeL;
+
+        if (root->rank - sibling->rank == 2)
+        {
+            root->rank--;
+
+            return root;
+        }
+
+        if (sibling->rank - Rank(sibling->nodeL) == 2 && sibling->rank - Rank(sibling->nodeR) == 2)
+        {
+            root->rank--;
+            root->nodeL = Own(sibling);
+            root->nodeL->rank--;
+
+            return root;
+        }
+
+        // L-L Case
+        if (sibling->rank - Rank(sibling->nodeL) == 1)
+        {
+            root = RotateR(root);
+            root->rank++;
+            root->nodeR->rank--;
+
+            if (!root->nodeR->nodeL && !root->nodeR->nodeR)
+            {
+                root->nodeR->rank--;
+            }
+
+            return root;
+        }
+
+        // L-R Case
+        root = RotateLR(root);
+        root->rank += 2;
+        root->nodeR->rank -= 2;
+        root->nodeL->rank--;
+
+        return root;
+    }
+
+    return root;
+}
@@ -6,20 +6,43 @@
 #define PROJECT_1_NODE_H
 
 // std...
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <unordered_set>
 #include <vector>
 #include <string>
 
+// custom...
+#include "Intern.h"
+
 /**
  * @class Node
  * 
  * @brief Represents a node in a Binary Search Tree (BST), more specifically that
  * of a self-balancing AVL tree.
  * 
- * Each node stores a value of type `long long`, a label of type `std::string`, and a cache of type `unsigned int`.
- * The cache is used to store the height of the node in the AVL tree.
+ * Each node stores a value of type `std::uint32_t`, a label of type `Intern::Handle`, a cache of type
+ * `std::uint8_t`, and a rank of the same type. The cache is used to store the height of the node in
+ * the AVL tree; the rank is only used under weak AVL balancing.
+ *
+ * The tree is balanced as a strict AVL tree by default. `Rebalance(Balance::WAVL)` switches to weak
+ * AVL balancing (Haeupler, Sen & Tarjan), which keeps a separate rank in every node next to its
+ * cache: rank differences between a node and its children are one or two, and every leaf has rank
+ * one. Without removals the trees are exactly AVL trees; with them they stay at most 2 log n tall,
+ * but a removal does at most two rotations, where a strict AVL removal may rotate at every level.
+ * The height is cached either way, so the level count printed is the true height of the tree, which
+ * may then be taller than the strict AVL tree would be.
+ *
+ * To keep nodes small, the value is stored in 32 bits (any 8-digit value fits) next to the cache,
+ * so the two share a single word ahead of the label and child pointers. The label itself is
+ * interned: the node only stores its 4-byte `Intern` handle, so equal labels are stored once, nodes
+ * copy their labels in a single move, and labels compare as integers.
  * 
  * The class provides functionalities for constructing and destructing nodes, as well as static methods for
- * inserting nodes, removing nodes, searching nodes, and printing nodes or their properties.
+ * searching nodes, and printing nodes or their properties. Inserting, removing, copying, and destroying
+ * nodes is left to the `Tree` owning them, which holds the root those private static methods take.
  * 
  * The class also provides private static methods for calculating the height of a node, the maximum height of a node's children,
  * the balance factor of a node, finding the in-order successor of a node, searching for a label in the tree,
@@ -37,24 +60,25 @@ public:
 
     /** 
      * @typedef Value
-     * @brief Represents the type of the stored value in the node.
-     * The value is of type `long long`.
+     * @brief Represents the type of the values taken and returned by the tree.
+     * The value is of type `unsigned long long`; the node stores it narrowed to `std::uint32_t`.
      */
     using Value = unsigned long long;
 
     /** 
      * @typedef Label
-     * @brief Represents the type of the stored label in the node.
-     * The label is of type `std::string`.
+     * @brief Represents the type of the labels taken and printed by the tree.
+     * The label is of type `std::string`; the node stores only its `Intern::Handle`.
      */
     using Label = std::string;
 
     /** 
      * @typedef Cache
      * @brief Represents the type of the stored cache in the node.
-     * The cache is used to store the height of the node in the AVL tree and is of type `unsigned int`.
+     * The cache is used to store the height of the node in the AVL tree and is of type `std::uint8_t`.
+     * An AVL tree of height 255 would need more nodes than any address space holds.
      */
-    using Cache = unsigned int;
+    using Cache = std::uint8_t;
 
     /** 
      * @enum Order
@@ -78,6 +102,70 @@ public:
         LRN,
     };
 
+    /**
+     * @enum Balance
+     * @brief Represents the balancing policies allowed in the tree.
+     */
+    enum class Balance
+    {
+        /**
+         * @brief Strict AVL balancing, by height.
+         */
+        AVL,
+
+        /**
+         * @brief Weak AVL balancing, by rank.
+         */
+        WAVL,
+    };
+
+    /**
+     * @class Scope
+     * @brief While alive, makes the calling thread's mutations copy-on-write.
+     *
+     * Instead of modifying a node in place, `Insert`, `Remove`, and `Clear` first copy it (unless
+     * the copy was made within the scope), so the tree they were given is never changed and
+     * concurrent readers of it stay safe. Every node that was copied or removed is collected
+     * into `retired` rather than freed; the owner of the scope decides when that's safe.
+     *
+     * Scopes nest: the innermost scope of the thread is the active one.
+     */
+    class Scope
+    {
+    public:
+
+        /**
+         * @brief Activates a new scope for the calling thread.
+         *
+         * Time complexity: O(1)
+         */
+        Scope();
+
+        /**
+         * @brief Deactivates the scope, restoring the previously active one.
+         *
+         * Time complexity: O(1)
+         */
+        ~Scope();
+
+        /**
+         * @brief The nodes reachable from the original tree that were copied or removed.
+         */
+        std::vector<Node*> retired;
+
+        /**
+         * @brief The nodes created within the scope, which may be modified in place.
+         */
+        std::unordered_set<Node*> fresh;
+
+    private:
+
+        /**
+         * @brief The scope that was active when this one was created.
+         */
+        Scope* previous;
+    };
+
     //
     // Construct / Destruct
     //
@@ -85,67 +173,38 @@ public:
     /**
      * @brief Constructs a new Node with the given value and label.
      * 
-     * @param value The value to be stored in the node.
+     * @param value The value to be stored in the node; at most 8 digits.
      * @param label The label to be stored in the node.
      * 
+     * Time complexity: O(l) on average where l is the length of the label.
+     * - Requires interning the label.
+     */
+    Node(Value value, Label label);
+
+    /**
+     * @brief Constructs a new Node with the given value and interned label.
+     *
+     * @param value The value to be stored in the node; at most 8 digits.
+     * @param label The handle of the label to be stored in the node.
+     *
      * Time complexity: O(1)
      * - Only requires the initialization of variables.
      */
-    Node(Value value, Label label);
+    Node(Value value, Intern::Handle label);
 
     //
     // Static Methods
     //
 
     /**
-     * @brief Inserts a new node with the given value and label into the tree rooted at the given node. 
-     * If inserted, "successful" is printed. Otherwise, "unsuccessful" is printed.
-     * 
-     * @param root The root of the tree where the new node will be inserted.
-     * @param value The value to be stored in the new node.
-     * @param label The label to be associated with the new node.
-     * 
-     * @return The root of the tree after the insertion.
-     * 
-     * Time complexity: O(log n) where n is the number of nodes in the `root` tree.
-     * - AVL tree insertion is a O(log n) process, as the tree is self-balancing.
-     * - If the tree were instead BST, the worst case scenario would be O(n)
-     */
-    static Node* Insert(Node* root, const Value& value, const Label& label);
-
-    /**
-     * @brief Removes the node with the given value from the tree rooted at the given node. If removed,
-     * "successful" is printed. Otherwise, "unsuccessful" is printed.
-     * 
-     * @param root The root of the tree where the node will be removed.
-     * @param value The value of the node to be removed.
-     * 
-     * @return The root of the tree after the removal.
-     * 
-     * Time complexity: O(log n) where n is the number of nodes in the `root` tree.
-     * - AVL tree deletion is a O(log n) process, as the tree is self-balancing.
-     * - Obtaining the balance factor is constant time since the height is cached in the node.
-     * - Each rotation, if even necessary, is constant time, thus adding no additional overhead.
-     */
-    static Node* Remove(Node* root, const Value& value);
-
-    /**
-     * @brief Removes the n-th node in the tree via an in-order traversal. If removed,
-     * "successful" is printed. Otherwise, "unsuccessful" is printed.
-     * 
-     * @param root The root of the tree where the node will be removed.
-     * @param n The in-order index of the node to be removed.
-     * 
-     * @return The root of the tree after the removal.
-     * 
-     * Time complexity: O(n * log(n)) where n is the number of nodes in the `root` tree.
-     * - Due to the algorithm programmed, the tree must first be traversed in its entirety to find
-     *   the n-th node in the tree. In the worst case, the node is found and thus has to be deleted.
-     * - To remove the node from the tree, the tree must be traversed via the original remove method,
-     *   which has O(log n) time complexity. Therefore, the total complexity is O(n * log(n)).
-     * - There is room for optimization.
+     * @brief Disposes of the given nodes, already unlinked from the tree, as `Clear` would.
+     * Nothing is printed.
+     *
+     * @param nodes The nodes to be disposed of.
+     *
+     * Time complexity: O(n) where n is the number of nodes.
      */
-    static Node* Remove(Node* root, unsigned int n);
+    static void Clear(const std::vector<Node*>& nodes);
 
     /**
      * @brief Searches for the node with the given value in the tree rooted at the given node. If found,
@@ -153,11 +212,25 @@ public:
      * 
      * @param root The root of the tree where the search will be performed.
      * @param value The value of the node to be searched for.
+     *
+     * @return `true` if the node was found, `false` otherwise.
      * 
      * Time complexity: O(log n) where n is the number of nodes in the `root` tree.
      * - AVL tree searches are a O(log n) process, as the tree is self-balancing.
      */
-    static void Search(const Node* root, const Value& value);
+    static bool Search(const Node* root, const Value& value);
+
+    /**
+     * @brief Finds the node with the given value in the tree rooted at the given node. Nothing is printed.
+     *
+     * @param root The root of the tree where the search will be performed.
+     * @param value The value of the node to be found.
+     *
+     * @return The node, or `nullptr` if there's none.
+     *
+     * Time complexity: O(log n) where n is the number of nodes in the `root` tree.
+     */
+    static const Node* Find(const Node* root, const Value& value);
 
     /**
      * @brief Searches for the node(s) with the given label in the tree rooted at the given node. If any
@@ -169,7 +242,8 @@ public:
      * 
      * Time complexity: O(n) where n is the number of nodes in the `root` tree.
      * - To find all nodes matching the label, all nodes must be traversed. Therefore, the worst case
-     *   (and average case, for that matter) is O(n).
+     *   (and average case, for that matter) is O(n). A label that was never interned matches no
+     *   node, so none are.
      */
     static void Search(const Node* root, const Label& label);
 
@@ -222,24 +296,201 @@ public:
      */
     static void PrintFailure();
 
+    /**
+     * @brief Left-pads a value with zeroes, such that it has the
+     * appearance of a valid 8-digit value.
+     *
+     * @param value The value to be padded.
+     *
+     * @return The value as a string, left-padded by zeroes.
+     *
+     * Time complexity: O(1)
+     * - Adding strings together is a constant time operation.
+     */
+    static Label Pad(const Value& value);
+
+    /**
+     * @brief Redirects everything the calling thread prints to the given stream. Other threads
+     * are unaffected, which lets each connection collect its own replies.
+     *
+     * @param stream The stream to be printed to. Defaults to `std::cout` for every thread.
+     *
+     * @return The stream that was previously printed to.
+     *
+     * Time complexity: O(1)
+     */
+    static std::ostream* Redirect(std::ostream* stream);
+
+    /**
+     * @brief Sets the balancing policy of every tree. Must be set before any tree is built, and
+     * never changed while one is kept, as the ranks of `WAVL` are only kept under it.
+     *
+     * @param balance The balancing policy to be used. Defaults to `Balance::AVL`.
+     *
+     * @return The balancing policy that was previously used.
+     *
+     * Time complexity: O(1)
+     */
+    static Balance Rebalance(Balance balance);
+
+    /**
+     * @brief Returns the number of rotations done by every insertion and removal so far, in every thread.
+     *
+     * Time complexity: O(1)
+     */
+    static std::size_t Rotations();
+
 private:
 
+    //
+    // Friends
+    //
+
+    /**
+     * @brief Only the tree owning the nodes may insert, remove, copy, or destroy them.
+     */
+    friend class Tree;
+
+    /**
+     * @brief The snapshot encoder walks and rebuilds the tree directly.
+     */
+    friend class Snapshot;
+
+    /**
+     * @brief The sharded engine merges its shards' traversals and label searches itself.
+     */
+    friend class Shards;
+
+    /**
+     * @brief The frozen copy reads the tree's nodes directly.
+     */
+    friend class Frozen;
+
+    /**
+     * @brief The versions measure the retired nodes they retain.
+     */
+    friend class Versions;
+
+    /**
+     * @brief The bitmap of IDs collects the tree's values directly.
+     */
+    friend class Roaring;
+
+    /**
+     * @brief The filter of IDs collects the tree's values directly.
+     */
+    friend class Bloom;
+
+    /**
+     * @brief The hash table of IDs reads the labels of the nodes it points to directly.
+     */
+    friend class Table;
+
+    /**
+     * @brief The hot-key cache copies the labels of the nodes it finds directly.
+     */
+    friend class Hot;
+
+    /**
+     * @brief The index of labels reads the labels of the tree's nodes directly.
+     */
+    friend class Names;
+
+    /**
+     * @brief The index of trigrams reads the labels of the tree's nodes directly.
+     */
+    friend class Grams;
+
+    /**
+     * @brief The columnar copy reads the tree's nodes directly.
+     */
+    friend class Column;
+
     //
     // Static Methods
     //
 
     /**
-     * @brief Left-pads a node's value with zeroes, such that it has the
-     * appearance of a valid 8-digit value.
+     * @brief Inserts a new node with the given value and label into the tree rooted at the given node. 
+     * If inserted, "successful" is printed. Otherwise, "unsuccessful" is printed.
+     * 
+     * @param root The root of the tree where the new node will be inserted.
+     * @param value The value to be stored in the new node.
+     * @param label The label to be associated with the new node.
+     * 
+     * @return The root of the tree after the insertion.
+     * 
+     * Time complexity: O(log n) where n is the number of nodes in the `root` tree.
+     * - AVL tree insertion is a O(log n) process, as the tree is self-balancing.
+     * - If the tree were instead BST, the worst case scenario would be O(n)
+     */
+    static Node* Insert(Node* root, const Value& value, const Label& label);
+
+    /**
+     * @brief Inserts a new node, as the above, and hands it back, so it needn't be found again.
+     *
+     * @param inserted Set to the new node, if inserted. Otherwise, left as is.
+     *
+     * Time complexity: O(log n) where n is the number of nodes in the `root` tree.
+     */
+    static Node* Insert(Node* root, const Value& value, const Label& label, const Node*& inserted);
+
+    /**
+     * @brief Removes the node with the given value from the tree rooted at the given node. If removed,
+     * "successful" is printed. Otherwise, "unsuccessful" is printed.
+     * 
+     * @param root The root of the tree where the node will be removed.
+     * @param value The value of the node to be removed.
+     * 
+     * @return The root of the tree after the removal.
+     * 
+     * Time complexity: O(log n) where n is the number of nodes in the `root` tree.
+     * - AVL tree deletion is a O(log n) process, as the tree is self-balancing.
+     * - Obtaining the balance factor is constant time since the height is cached in the node.
+     * - Each rotation, if even necessary, is constant time, thus adding no additional overhead.
+     *   Under `WAVL`, at most two are done.
+     */
+    static Node* Remove(Node* root, const Value& value);
+
+    /**
+     * @brief Removes the n-th node in the tree via an in-order traversal. If removed,
+     * "successful" is printed. Otherwise, "unsuccessful" is printed.
+     * 
+     * @param root The root of the tree where the node will be removed.
+     * @param n The in-order index of the node to be removed.
+     * 
+     * @return The root of the tree after the removal.
+     * 
+     * Time complexity: O(n * log(n)) where n is the number of nodes in the `root` tree.
+     * - Due to the algorithm programmed, the tree must first be traversed in its entirety to find
+     *   the n-th node in the tree. In the worst case, the node is found and thus has to be deleted.
+     * - To remove the node from the tree, the tree must be traversed via the original remove method,
+     *   which has O(log n) time complexity. Therefore, the total complexity is O(n * log(n)).
+     * - There is room for optimization.
+     */
+    static Node* Remove(Node* root, unsigned int n);
+
+    /**
+     * @brief Destroys every node in the tree rooted at the given node. Nothing is printed.
      *
-     * @param node The node whose value will be interpreted.
+     * @param root The root of the tree to be destroyed.
      *
-     * @return The node's value as a string, left-padded by zeroes.
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     * - Every node must be visited once to be freed.
+     */
+    static void Clear(Node* root);
+
+    /**
+     * @brief Copies every node in the tree rooted at the given node. Nothing is printed.
      *
-     * Time complexity: O(1)
-     * - Adding strings together is a constant time operation.
+     * @param root The root of the tree to be copied.
+     *
+     * @return The root of the copy.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     * - Every node must be visited once to be copied.
      */
-     static Label Pad(const Node* node);
+    static Node* Copy(const Node* root);
 
     /**
      * @brief Safely returns the cached height of the node.
@@ -281,31 +532,33 @@ private:
     static int Factor(Node* node);
 
     /**
-     * @brief Finds the in-order successor of the given node.
+     * @brief Unlinks the node with the smallest value from the tree rooted at the given node, such as
+     * the in-order successor of a node from its right subtree. The node itself is kept intact.
      * 
-     * @param root The root of the tree in which to find the successor.
+     * @param root The root of the tree from which to unlink the node.
+     * @param min Set to the unlinked node.
      * 
-     * @return The in-order successor of the node.
+     * @return The root of the tree after the unlinking.
      * 
      * Time complexity: O(log n) where n is the number of nodes in the `root` tree.
      * - Traversing the tree by value is a O(log n) operation since the tree
      *   is self-balancing.
      */
-    static Node* Successor(Node* root);
+    static Node* Detach(Node* root, Node*& min);
 
     /**
      * @brief A helper function for the public method `Search`. Searches for the node(s) with the given label in the
      * tree and appends the value(s) to `output`.
      * 
      * @param root The root of the tree where the search will be performed.
-     * @param label The label of the node to be searched for.
+     * @param label The handle of the label of the node to be searched for.
      * @param output The value(s) of the nodes matching the label. May be empty.
      * 
      * Time complexity: O(n) where n is the number of nodes in the `root` tree.
      * - To find all nodes matching the label, all nodes must be traversed. Therefore, the worst case
      *   (and average case, for that matter) is O(n).
      */
-    static void Search(const Node* root, const Label& label, std::string& output);
+    static void Search(const Node* root, Intern::Handle label, std::string& output);
 
     /**
      * @brief A helper function for the public method `Print`. Traverses the tree and appends each node's
@@ -401,21 +654,118 @@ private:
      */
     static Node* Repair(Node* root);
 
+    /**
+     * @brief Returns the rank of the given node under `WAVL`, or zero if the node is null.
+     *
+     * Time complexity: O(1)
+     */
+    static Cache Rank(const Node* node);
+
+    /**
+     * @brief Rebalances the tree rooted at the given node after an insertion below it, with the
+     * balancing policy in use. Under `WAVL`, a child of the same rank as the node is repaired by a
+     * promotion, which may leave the node for its parent to repair, or by at most two rotations.
+     *
+     * @param root The root of the tree to be rebalanced. Must be safe to modify.
+     *
+     * @return The new root of the tree after the rebalancing.
+     *
+     * Time complexity: O(1)
+     */
+    static Node* Promote(Node* root);
+
+    /**
+     * @brief Rebalances the tree rooted at the given node after a removal below it, with the balancing
+     * policy in use. Under `WAVL`, a child three ranks below the node is repaired by demotions, which
+     * may leave the node for its parent to repair, or by at most two rotations.
+     *
+     * @param root The root of the tree to be rebalanced. Must be safe to modify.
+     *
+     * @return The new root of the tree after the rebalancing.
+     *
+     * Time complexity: O(1)
+     */
+    static Node* Demote(Node* root);
+
+    /**
+     * @brief Creates a new node, registering it with the active scope (if any).
+     *
+     * @param value The value to be stored in the node.
+     * @param label The label to be stored in the node.
+     *
+     * @return The new node.
+     *
+     * Time complexity: O(1)
+     */
+    static Node* Create(const Value& value, const Label& label);
+
+    /**
+     * @brief Creates a new node with an interned label, registering it with the active scope (if any).
+     *
+     * @param value The value to be stored in the node.
+     * @param label The handle of the label to be stored in the node.
+     *
+     * @return The new node.
+     *
+     * Time complexity: O(1)
+     */
+    static Node* Create(const Value& value, Intern::Handle label);
+
+    /**
+     * @brief Makes the given node safe to modify. Without an active scope, or if the node was
+     * created within it, the node itself is returned. Otherwise, the node is retired and a copy is returned.
+     *
+     * @param node The node about to be modified. May be null.
+     *
+     * @return The node to modify in its place.
+     *
+     * Time complexity: O(1)
+     */
+    static Node* Own(Node* node);
+
+    /**
+     * @brief Disposes of a node unlinked from the tree. Without an active scope, or if the node was
+     * created within it, the node is freed. Otherwise, the node is retired.
+     *
+     * @param node The node to be disposed of.
+     *
+     * Time complexity: O(1)
+     */
+    static void Release(Node* node);
+
     //
-    // Properties
+    // Static Properties
     //
 
-    /** 
-     * @brief Represents the stored value of the node. 
-     * The value is of type `Value`.
+    /**
+     * @brief Represents the stream the calling thread prints to.
      */
-    Value value;
+    static thread_local std::ostream* stream;
+
+    /**
+     * @brief Represents the calling thread's active scope, or null if mutations happen in place.
+     */
+    static thread_local Scope* scope;
+
+    /**
+     * @brief Represents the balancing policy of every tree.
+     */
+    static Balance balance;
+
+    /**
+     * @brief Represents the number of rotations done so far, in every thread.
+     */
+    static std::atomic<std::size_t> rotations;
+
+    //
+    // Properties
+    //
 
     /** 
-     * @brief Represents the stored label of the node. 
-     * The label is of type `Label`.
+     * @brief Represents the stored value of the node. 
+     * The value is a `Value` narrowed to 32 bits, which holds every 8-digit value.
      */
-    Label label;
+    std::uint32_t value;
 
     /** 
      * @brief Represents the stored cache of the node. 
@@ -423,6 +773,18 @@ private:
      */
     Cache cache;
 
+    /**
+     * @brief Represents the rank of the node under `WAVL`, kept next to the cache so the node
+     * stays the same size. Unused under `AVL`.
+     */
+    Cache rank;
+
+    /** 
+     * @brief Represents the stored label of the node. 
+     * The label is the `Intern` handle of a `Label`.
+     */
+    Intern::Handle label;
+
     /** 
      * @brief Represents the stored left-node pointer of the current node. 
      * Points to the left child node in the AVL tree.
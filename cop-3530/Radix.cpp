@@ -0,0 +1,908 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+// sys...
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// custom...
+#include "Radix.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Radix::~Radix()
+{
+    Clear(this->root);
+}
+
+//
+// Methods
+//
+
+void Radix::Insert(const Node::Value& value, const Node::Label& label)
+{
+    std::unique_lock<std::shared_timed_mutex> guard(this->lock);
+
+    // Keys only hold four bytes; anything wider couldn't be told apart.
+    if (value > std::numeric_limits<std::uint32_t>::max())
+    {
+        Node::PrintFailure();
+    }
+
+    else if (Insert(this->root, static_cast<std::uint32_t>(value), label, 0))
+    {
+        this->size++;
+
+        Node::PrintSuccess();
+    }
+
+    // Value already stored; unsuccessful insert!
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void Radix::Remove(const Node::Value& value)
+{
+    std::unique_lock<std::shared_timed_mutex> guard(this->lock);
+
+    if (value <= std::numeric_limits<std::uint32_t>::max() && Remove(this->root, static_cast<std::uint32_t>(value), 0))
+    {
+        this->size--;
+
+        Node::PrintSuccess();
+    }
+
+    // Value not stored; unsuccessful remove!
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void Radix::Remove(unsigned int n)
+{
+    std::unique_lock<std::shared_timed_mutex> guard(this->lock);
+
+    // N-th position unobtainable; unsuccessful remove!
+    if (n >= this->size)
+    {
+        Node::PrintFailure();
+
+        return;
+    }
+
+    std::size_t i = 0;
+    std::uint32_t key = 0;
+
+    auto visit = [&](const Leaf* leaf)
+    {
+        if (i++ == n)
+        {
+            key = leaf->key;
+        }
+    };
+
+    Walk(this->root, visit);
+
+    Remove(this->root, key, 0);
+    this->size--;
+
+    Node::PrintSuccess();
+}
+
+void Radix::Search(const Node::Value& value)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    const Leaf* leaf = (value <= std::numeric_limits<std::uint32_t>::max())
+        ? Find(this->root, static_cast<std::uint32_t>(value))
+        : nullptr;
+
+    if (leaf)
+    {
+        Node::Print(leaf->label);
+    }
+
+    // Value not stored; unsuccessful search!
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void Radix::Search(const Node::Label& label)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    std::string result;
+
+    auto visit = [&](const Leaf* leaf)
+    {
+        if (leaf->label == label)
+        {
+            result.append(Node::Pad(leaf->key));
+            result.append("\n");
+        }
+    };
+
+    Walk(this->root, visit);
+
+    if (!result.empty())
+    {
+        // Print, but remove the last newline insertion.
+        Node::Print(result.substr(0, result.rfind('\n')));
+    }
+
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void Radix::Print(Node::Order order)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    // Every order lists the labels by value; see the class description.
+    (void) order;
+
+    std::string result;
+
+    auto visit = [&](const Leaf* leaf)
+    {
+        result.append(leaf->label);
+        result.append(", ");
+    };
+
+    Walk(this->root, visit);
+
+    if (!result.empty())
+    {
+        // Print, but remove the last ", " comma insertion.
+        Node::Print(result.substr(0, result.rfind(',')));
+    }
+
+    else
+    {
+        Node::Print(result);
+    }
+}
+
+void Radix::Print()
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    Node::Print(std::to_string(Depth(this->root)));
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Static Methods
+//
+
+std::uint8_t Radix::Byte(std::uint32_t key, unsigned int depth)
+{
+    return static_cast<std::uint8_t>(key >> (24 - 8 * depth));
+}
+
+unsigned int Radix::Match(const Radix::Header* node, std::uint32_t key, unsigned int depth)
+{
+    unsigned int i = 0;
+
+    while (i < node->length && node->prefix[i] == Byte(key, depth + i))
+    {
+        i++;
+    }
+
+    return i;
+}
+
+void Radix::Inherit(Radix::Header* node, const Radix::Header* from)
+{
+    node->count = from->count;
+    node->length = from->length;
+
+    std::memcpy(node->prefix, from->prefix, sizeof(node->prefix));
+}
+
+Radix::Header** Radix::Child(Radix::Header* node, std::uint8_t byte)
+{
+    switch (node->kind)
+    {
+        case NODE4:
+        {
+            Node4* inner = static_cast<Node4*>(node);
+
+            for (unsigned int i = 0; i < inner->count; i++)
+            {
+                if (inner->keys[i] == byte)
+                {
+                    return &inner->children[i];
+                }
+            }
+
+            return nullptr;
+        }
+
+        case NODE16:
+        {
+            Node16* inner = static_cast<Node16*>(node);
+
+#ifdef __SSE2__
+            // Compare the byte against all sixteen keys at once.
+            const __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inner->keys));
+            const __m128i matches = _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+            const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(matches)) & ((1u << inner->count) - 1);
+
+            return mask ? &inner->children[__builtin_ctz(mask)] : nullptr;
+#else
+            for (unsigned int i = 0; i < inner->count; i++)
+            {
+                if (inner->keys[i] == byte)
+                {
+                    return &inner->children[i];
+                }
+            }
+
+            return nullptr;
+#endif
+        }
+
+        case NODE48:
+        {
+            Node48* inner = static_cast<Node48*>(node);
+
+            return inner->index[byte] ? &inner->children[inner->index[byte] - 1] : nullptr;
+        }
+
+        case NODE256:
+        {
+            Node256* inner = static_cast<Node256*>(node);
+
+            return inner->children[byte] ? &inner->children[byte] : nullptr;
+        }
+
+        default:
+        {
+            return nullptr;
+        }
+    }
+}
+
+void Radix::Add(Radix::Header*& node, std::uint8_t byte, Radix::Header* child)
+{
+    switch (node->kind)
+    {
+        case NODE4:
+        {
+            Node4* inner = static_cast<Node4*>(node);
+
+            // Full; grow into a Node16.
+            if (inner->count == 4)
+            {
+                Node16* grown = new Node16();
+                Inherit(grown, inner);
+
+                std::copy(inner->keys, inner->keys + 4, grown->keys);
+                std::copy(inner->children, inner->children + 4, grown->children);
+
+                delete inner;
+                node = grown;
+
+                Add(node, byte, child);
+
+                return;
+            }
+
+            unsigned int position = 0;
+            while (position < inner->count && inner->keys[position] < byte)
+            {
+                position++;
+            }
+
+            std::copy_backward(inner->keys + position, inner->keys + inner->count, inner->keys + inner->count + 1);
+            std::copy_backward(inner->children + position, inner->children + inner->count, inner->children + inner->count + 1);
+
+            inner->keys[position] = byte;
+            inner->children[position] = child;
+            inner->count++;
+
+            return;
+        }
+
+        case NODE16:
+        {
+            Node16* inner = static_cast<Node16*>(node);
+
+            // Full; grow into a Node48.
+            if (inner->count == 16)
+            {
+                Node48* grown = new Node48();
+                Inherit(grown, inner);
+
+                for (unsigned int i = 0; i < 16; i++)
+                {
+                    grown->index[inner->keys[i]] = static_cast<std::uint8_t>(i + 1);
+                    grown->children[i] = inner->children[i];
+                }
+
+                delete inner;
+                node = grown;
+
+                Add(node, byte, child);
+
+                return;
+            }
+
+#ifdef __SSE2__
+            // Count the keys below the byte at once; they're sorted, so that's the position. Bytes
+            // compare signed, so flip their sign bits to order them as unsigned.
+            const __m128i flip = _mm_set1_epi8(static_cast<char>(0x80));
+            const __m128i keys = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(inner->keys)), flip);
+            const __m128i less = _mm_cmplt_epi8(keys, _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), flip));
+            const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(less)) & ((1u << inner->count) - 1);
+            const unsigned int position = static_cast<unsigned int>(__builtin_popcount(mask));
+#else
+            unsigned int position = 0;
+            while (position < inner->count && inner->keys[position] < byte)
+            {
+                position++;
+            }
+#endif
+
+            std::copy_backward(inner->keys + position, inner->keys + inner->count, inner->keys + inner->count + 1);
+            std::copy_backward(inner->children + position, inner->children + inner->count, inner->children + inner->count + 1);
+
+            inner->keys[position] = byte;
+            inner->children[position] = child;
+            inner->count++;
+
+            return;
+        }
+
+        case NODE48:
+        {
+            Node48* inner = static_cast<Node48*>(node);
+
+            // Full; grow into a Node256.
+            if (inner->count == 48)
+            {
+                Node256* grown = new Node256();
+                Inherit(grown, inner);
+
+                for (unsigned int b = 0; b < 256; b++)
+                {
+                    if (inner->index[b])
+                    {
+                        grown->children[b] = inner->children[inner->index[b] - 1];
+                    }
+                }
+
+                delete inner;
+                node = grown;
+
+                Add(node, byte, child);
+
+                return;
+            }
+
+            // Removals may leave any slot free.
+            unsigned int slot = 0;
+            while (inner->children[slot])
+            {
+                slot++;
+            }
+
+            inner->index[byte] = static_cast<std::uint8_t>(slot + 1);
+            inner->children[slot] = child;
+            inner->count++;
+
+            return;
+        }
+
+        case NODE256:
+        {
+            Node256* inner = static_cast<Node256*>(node);
+
+            inner->children[byte] = child;
+            inner->count++;
+
+            return;
+        }
+
+        default:
+        {
+            return;
+        }
+    }
+}
+
+void Radix::Erase(Radix::Header*& node, std::uint8_t byte)
+{
+    switch (node->kind)
+    {
+        case NODE4:
+        {
+            Node4* inner = static_cast<Node4*>(node);
+
+            const unsigned int position = static_cast<unsigned int>(Child(node, byte) - inner->children);
+
+            std::copy(inner->keys + position + 1, inner->keys + inner->count, inner->keys + position);
+            std::copy(inner->children + position + 1, inner->children + inner->count, inner->children + position);
+            inner->count--;
+
+            // A single child left; replace the node with it, which takes over the node's prefix.
+            if (inner->count == 1)
+            {
+                Header* child = inner->children[0];
+
+                if (child->kind != LEAF)
+                {
+                    std::uint8_t prefix[sizeof(child->prefix)];
+                    unsigned int length = 0;
+
+                    std::copy(inner->prefix, inner->prefix + inner->length, prefix);
+                    length += inner->length;
+
+                    prefix[length++] = inner->keys[0];
+
+                    std::copy(child->prefix, child->prefix + child->length, prefix + length);
+                    length += child->length;
+
+                    std::copy(prefix, prefix + length, child->prefix);
+                    child->length = static_cast<std::uint8_t>(length);
+                }
+
+                delete inner;
+                node = child;
+            }
+
+            return;
+        }
+
+        case NODE16:
+        {
+            Node16* inner = static_cast<Node16*>(node);
+
+            const unsigned int position = static_cast<unsigned int>(Child(node, byte) - inner->children);
+
+            std::copy(inner->keys + position + 1, inner->keys + inner->count, inner->keys + position);
+            std::copy(inner->children + position + 1, inner->children + inner->count, inner->children + position);
+            inner->count--;
+
+            // Sparse; shrink into a Node4.
+            if (inner->count == 3)
+            {
+                Node4* shrunk = new Node4();
+                Inherit(shrunk, inner);
+
+                std::copy(inner->keys, inner->keys + 3, shrunk->keys);
+                std::copy(inner->children, inner->children + 3, shrunk->children);
+
+                delete inner;
+                node = shrunk;
+            }
+
+            return;
+        }
+
+        case NODE48:
+        {
+            Node48* inner = static_cast<Node48*>(node);
+
+            inner->children[inner->index[byte] - 1] = nullptr;
+            inner->index[byte] = 0;
+            inner->count--;
+
+            // Sparse; shrink into a Node16, keeping the keys sorted.
+            if (inner->count == 12)
+            {
+                Node16* shrunk = new Node16();
+                Inherit(shrunk, inner);
+
+                unsigned int i = 0;
+                for (unsigned int b = 0; b < 256; b++)
+                {
+                    if (inner->index[b])
+                    {
+                        shrunk->keys[i] = static_cast<std::uint8_t>(b);
+                        shrunk->children[i] = inner->children[inner->index[b] - 1];
+                        i++;
+                    }
+                }
+
+                delete inner;
+                node = shrunk;
+            }
+
+            return;
+        }
+
+        case NODE256:
+        {
+            Node256* inner = static_cast<Node256*>(node);
+
+            inner->children[byte] = nullptr;
+            inner->count--;
+
+            // Sparse; shrink into a Node48.
+            if (inner->count == 37)
+            {
+                Node48* shrunk = new Node48();
+                Inherit(shrunk, inner);
+
+                unsigned int slot = 0;
+                for (unsigned int b = 0; b < 256; b++)
+                {
+                    if (inner->children[b])
+                    {
+                        shrunk->index[b] = static_cast<std::uint8_t>(slot + 1);
+                        shrunk->children[slot++] = inner->children[b];
+                    }
+                }
+
+                delete inner;
+                node = shrunk;
+            }
+
+            return;
+        }
+
+        default:
+        {
+            return;
+        }
+    }
+}
+
+bool Radix::Insert(Radix::Header*& node, std::uint32_t key, const Node::Label& label, unsigned int depth)
+{
+    // Empty slot; place the leaf here.
+    if (!node)
+    {
+        node = new Leaf(key, label);
+
+        return true;
+    }
+
+    // Another leaf; branch where the two keys first differ.
+    if (node->kind == LEAF)
+    {
+        Leaf* leaf = static_cast<Leaf*>(node);
+
+        if (leaf->key == key)
+        {
+            return false;
+        }
+
+        unsigned int differ = depth;
+        while (Byte(leaf->key, differ) == Byte(key, differ))
+        {
+            differ++;
+        }
+
+        Header* inner = new Node4();
+        inner->length = static_cast<std::uint8_t>(differ - depth);
+
+        for (unsigned int i = 0; i < inner->length; i++)
+        {
+            inner->prefix[i] = Byte(key, depth + i);
+        }
+
+        Add(inner, Byte(leaf->key, differ), leaf);
+        Add(inner, Byte(key, differ), new Leaf(key, label));
+
+        node = inner;
+
+        return true;
+    }
+
+    const unsigned int matched = Match(node, key, depth);
+
+    // The key leaves the prefix; branch where it does, the node keeping what follows.
+    if (matched < node->length)
+    {
+        Header* inner = new Node4();
+        inner->length = static_cast<std::uint8_t>(matched);
+
+        std::copy(node->prefix, node->prefix + matched, inner->prefix);
+
+        const std::uint8_t branch = node->prefix[matched];
+
+        node->length = static_cast<std::uint8_t>(node->length - matched - 1);
+        std::copy(node->prefix + matched + 1, node->prefix + matched + 1 + node->length, node->prefix);
+
+        Add(inner, branch, node);
+        Add(inner, Byte(key, depth + matched), new Leaf(key, label));
+
+        node = inner;
+
+        return true;
+    }
+
+    depth += node->length;
+
+    Header** child = Child(node, Byte(key, depth));
+
+    // Descend...
+    if (child)
+    {
+        return Insert(*child, key, label, depth + 1);
+    }
+
+    Add(node, Byte(key, depth), new Leaf(key, label));
+
+    return true;
+}
+
+bool Radix::Remove(Radix::Header*& node, std::uint32_t key, unsigned int depth)
+{
+    if (!node)
+    {
+        return false;
+    }
+
+    // Only the root may be a leaf here; deeper leaves are removed by their parent.
+    if (node->kind == LEAF)
+    {
+        if (static_cast<Leaf*>(node)->key != key)
+        {
+            return false;
+        }
+
+        delete static_cast<Leaf*>(node);
+        node = nullptr;
+
+        return true;
+    }
+
+    if (Match(node, key, depth) < node->length)
+    {
+        return false;
+    }
+
+    depth += node->length;
+
+    const std::uint8_t byte = Byte(key, depth);
+    Header** child = Child(node, byte);
+
+    if (!child)
+    {
+        return false;
+    }
+
+    // Descend...
+    if ((*child)->kind != LEAF)
+    {
+        return Remove(*child, key, depth + 1);
+    }
+
+    if (static_cast<Leaf*>(*child)->key != key)
+    {
+        return false;
+    }
+
+    delete static_cast<Leaf*>(*child);
+    Erase(node, byte);
+
+    return true;
+}
+
+const Radix::Leaf* Radix::Find(const Radix::Header* node, std::uint32_t key)
+{
+    unsigned int depth = 0;
+
+    while (node)
+    {
+        if (node->kind == LEAF)
+        {
+            const Leaf* leaf = static_cast<const Leaf*>(node);
+
+            return (leaf->key == key) ? leaf : nullptr;
+        }
+
+        if (Match(node, key, depth) < node->length)
+        {
+            return nullptr;
+        }
+
+        depth += node->length;
+
+        Header** child = Child(const_cast<Header*>(node), Byte(key, depth++));
+        node = child ? *child : nullptr;
+    }
+
+    return nullptr;
+}
+
+template <typename Visit>
+void Radix::Walk(const Radix::Header* node, Visit& visit)
+{
+    if (!node)
+    {
+        return;
+    }
+
+    switch (node->kind)
+    {
+        case LEAF:
+        {
+            visit(static_cast<const Leaf*>(node));
+
+            return;
+        }
+
+        case NODE4:
+        {
+            const Node4* inner = static_cast<const Node4*>(node);
+
+            for (unsigned int i = 0; i < inner->count; i++)
+            {
+                Walk(inner->children[i], visit);
+            }
+
+            return;
+        }
+
+        case NODE16:
+        {
+            const Node16* inner = static_cast<const Node16*>(node);
+
+            for (unsigned int i = 0; i < inner->count; i++)
+            {
+                Walk(inner->children[i], visit);
+            }
+
+            return;
+        }
+
+        case NODE48:
+        {
+            const Node48* inner = static_cast<const Node48*>(node);
+
+            for (unsigned int b = 0; b < 256; b++)
+            {
+                if (inner->index[b])
+                {
+                    Walk(inner->children[inner->index[b] - 1], visit);
+                }
+            }
+
+            return;
+        }
+
+        case NODE256:
+        {
+            const Node256* inner = static_cast<const Node256*>(node);
+
+            for (unsigned int b = 0; b < 256; b++)
+            {
+                Walk(inner->children[b], visit);
+            }
+
+            return;
+        }
+    }
+}
+
+unsigned int Radix::Depth(const Radix::Header* node)
+{
+    if (!node)
+    {
+        return 0;
+    }
+
+    if (node->kind == LEAF)
+    {
+        return 1;
+    }
+
+    unsigned int depth = 0;
+
+    for (unsigned int b = 0; b < 256; b++)
+    {
+        Header** child = Child(const_cast<Header*>(node), static_cast<std::uint8_t>(b));
+
+        if (child)
+        {
+            depth = std::max(depth, Depth(*child));
+        }
+    }
+
+    return depth + 1;
+}
+
+void Radix::Clear(Radix::Header* node)
+{
+    if (!node)
+    {
+        return;
+    }
+
+    switch (node->kind)
+    {
+        case LEAF:
+        {
+            delete static_cast<Leaf*>(node);
+
+            return;
+        }
+
+        case NODE4:
+        {
+            Node4* inner = static_cast<Node4*>(node);
+
+            for (unsigned int i = 0; i < inner->count; i++)
+            {
+                Clear(inner->children[i]);
+            }
+
+            delete inner;
+
+            return;
+        }
+
+        case NODE16:
+        {
+            Node16* inner = static_cast<Node16*>(node);
+
+            for (unsigned int i = 0; i < inner->count; i++)
+            {
+                Clear(inner->children[i]);
+            }
+
+            delete inner;
+
+            return;
+        }
+
+        case NODE48:
+        {
+            Node48* inner = static_cast<Node48*>(node);
+
+            for (Header* child : inner->children)
+            {
+                Clear(child);
+            }
+
+            delete inner;
+
+            return;
+        }
+
+        case NODE256:
+        {
+            Node256* inner = static_cast<Node256*>(node);
+
+            for (Header* child : inner->children)
+            {
+                Clear(child);
+            }
+
+            delete inner;
+
+            return;
+        }
+    }
+}
@@ -0,0 +1,310 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_RADIX_H
+#define PROJECT_1_RADIX_H
+
+// std...
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+
+// custom...
+#include "Engine.h"
+
+/**
+ * @class Radix
+ *
+ * @brief Represents an engine storing the values in an adaptive radix tree (ART), keyed on the
+ * four big-endian bytes of the value; every value below 100,000,000 fits in them.
+ *
+ * Each inner node branches on one byte of the key, and adapts its size to its number of children:
+ * up to 4 and 16 children are kept as sorted arrays of key bytes (the 16 searched with SIMD where
+ * available), up to 48 behind a 256-entry index, and up to 256 directly. Bytes shared by every key
+ * below a node are kept as the node's prefix instead of a chain of single-child nodes, and a leaf
+ * is only placed as deep as needed to tell it apart. Lookups thus take at most four steps, and no
+ * rebalancing is ever needed.
+ *
+ * Keys are kept in order, so in-order prints list the labels by value. As the tree has no shape
+ * comparable to the AVL tree, pre-order and post-order prints do the same, and the level count is
+ * the depth of the deepest leaf. Reads share a lock, writes take it exclusively.
+ */
+class Radix : public Engine
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs an empty tree.
+     *
+     * Time complexity: O(1)
+     */
+    Radix() = default;
+
+    /**
+     * @brief Destroys every node of the tree.
+     *
+     * Time complexity: O(n) where n is the number of values stored.
+     */
+    ~Radix() override;
+
+    //
+    // Methods
+    //
+
+    void Insert(const Node::Value& value, const Node::Label& label) override;
+
+    void Remove(const Node::Value& value) override;
+
+    void Remove(unsigned int n) override;
+
+    void Search(const Node::Value& value) override;
+
+    void Search(const Node::Label& label) override;
+
+    void Print(Node::Order order) override;
+
+    void Print() override;
+
+private:
+
+    //
+    // Enums
+    //
+
+    /**
+     * @enum Kind
+     * @brief Represents the layout of a node.
+     */
+    enum Kind : std::uint8_t
+    {
+        LEAF,
+        NODE4,
+        NODE16,
+        NODE48,
+        NODE256,
+    };
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Header
+     * @brief Represents what every node starts with.
+     */
+    struct Header
+    {
+        /**
+         * @brief The layout of the node.
+         */
+        Kind kind;
+
+        /**
+         * @brief The number of children. Unused by leaves.
+         */
+        std::uint16_t count = 0;
+
+        /**
+         * @brief The number of bytes in `prefix`. Unused by leaves.
+         */
+        std::uint8_t length = 0;
+
+        /**
+         * @brief The key bytes shared by every leaf below the node, past its parent's. Unused by leaves.
+         */
+        std::uint8_t prefix[3] = {};
+
+        explicit Header(Kind kind) : kind(kind) {}
+    };
+
+    /**
+     * @struct Leaf
+     * @brief Represents a stored value and its label.
+     */
+    struct Leaf : Header
+    {
+        std::uint32_t key;
+
+        Node::Label label;
+
+        Leaf(std::uint32_t key, Node::Label label) : Header(LEAF), key(key), label(std::move(label)) {}
+    };
+
+    /**
+     * @struct Node4
+     * @brief Represents an inner node of up to 4 children, sorted by key byte.
+     */
+    struct Node4 : Header
+    {
+        std::uint8_t keys[4] = {};
+
+        Header* children[4] = {};
+
+        Node4() : Header(NODE4) {}
+    };
+
+    /**
+     * @struct Node16
+     * @brief Represents an inner node of up to 16 children, sorted by key byte.
+     */
+    struct Node16 : Header
+    {
+        std::uint8_t keys[16] = {};
+
+        Header* children[16] = {};
+
+        Node16() : Header(NODE16) {}
+    };
+
+    /**
+     * @struct Node48
+     * @brief Represents an inner node of up to 48 children. `index` holds, for every key byte,
+     * one plus the slot of its child, or `0` if it has none.
+     */
+    struct Node48 : Header
+    {
+        std::uint8_t index[256] = {};
+
+        Header* children[48] = {};
+
+        Node48() : Header(NODE48) {}
+    };
+
+    /**
+     * @struct Node256
+     * @brief Represents an inner node with a slot for every key byte.
+     */
+    struct Node256 : Header
+    {
+        Header* children[256] = {};
+
+        Node256() : Header(NODE256) {}
+    };
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Returns the byte of the key branched on at the given depth, the most significant first.
+     *
+     * Time complexity: O(1)
+     */
+    static std::uint8_t Byte(std::uint32_t key, unsigned int depth);
+
+    /**
+     * @brief Returns how many bytes of the node's prefix match the key from the given depth on.
+     *
+     * Time complexity: O(1)
+     */
+    static unsigned int Match(const Header* node, std::uint32_t key, unsigned int depth);
+
+    /**
+     * @brief Copies the count and prefix of one inner node into another, when resizing it.
+     *
+     * Time complexity: O(1)
+     */
+    static void Inherit(Header* node, const Header* from);
+
+    /**
+     * @brief Returns the slot of the child for the given key byte, or `nullptr` if there's none.
+     *
+     * Time complexity: O(1)
+     */
+    static Header** Child(Header* node, std::uint8_t byte);
+
+    /**
+     * @brief Adds a child for the given key byte, growing the node into the next size if it's full.
+     *
+     * @param node The node; replaced if grown.
+     * @param byte The key byte, without a child yet.
+     * @param child The child to be added.
+     *
+     * Time complexity: O(1)
+     */
+    static void Add(Header*& node, std::uint8_t byte, Header* child);
+
+    /**
+     * @brief Removes the child for the given key byte, shrinking the node into the previous size
+     * once it's sparse enough, or replacing it with its last child.
+     *
+     * @param node The node; replaced if shrunk.
+     * @param byte The key byte, with a child.
+     *
+     * Time complexity: O(1)
+     */
+    static void Erase(Header*& node, std::uint8_t byte);
+
+    /**
+     * @brief Inserts the key below the given node, at the given depth.
+     *
+     * @return `false` if the key was already stored, `true` otherwise.
+     *
+     * Time complexity: O(k) where k is the number of key bytes.
+     */
+    static bool Insert(Header*& node, std::uint32_t key, const Node::Label& label, unsigned int depth);
+
+    /**
+     * @brief Removes the key from below the given node, at the given depth.
+     *
+     * @return `false` if the key wasn't stored, `true` otherwise.
+     *
+     * Time complexity: O(k) where k is the number of key bytes.
+     */
+    static bool Remove(Header*& node, std::uint32_t key, unsigned int depth);
+
+    /**
+     * @brief Returns the leaf storing the key, or `nullptr` if there's none.
+     *
+     * Time complexity: O(k) where k is the number of key bytes.
+     */
+    static const Leaf* Find(const Header* node, std::uint32_t key);
+
+    /**
+     * @brief Visits every leaf below the given node, in key order.
+     *
+     * Time complexity: O(n) where n is the number of nodes below `node`.
+     */
+    template <typename Visit>
+    static void Walk(const Header* node, Visit& visit);
+
+    /**
+     * @brief Returns the number of levels below the given node, itself included.
+     *
+     * Time complexity: O(n) where n is the number of nodes below `node`.
+     */
+    static unsigned int Depth(const Header* node);
+
+    /**
+     * @brief Destroys the given node and every node below it.
+     *
+     * Time complexity: O(n) where n is the number of nodes below `node`.
+     */
+    static void Clear(Header* node);
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the root of the tree.
+     */
+    Header* root = nullptr;
+
+    /**
+     * @brief Represents the number of values stored.
+     */
+    std::size_t size = 0;
+
+    /**
+     * @brief Held shared by reads and exclusively by writes.
+     */
+    std::shared_timed_mutex lock;
+};
+
+#endif //PROJECT_1_RADIX_H
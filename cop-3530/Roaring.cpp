@@ -0,0 +1,345 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+
+// custom...
+#include "Roaring.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Roaring::Roaring(const Node* root)
+{
+    Fill(root);
+}
+
+//
+// Methods
+//
+
+bool Roaring::Add(std::uint32_t value)
+{
+    const std::uint16_t high = static_cast<std::uint16_t>(value >> 16);
+    const std::uint16_t low = static_cast<std::uint16_t>(value);
+
+    const auto position = std::lower_bound(this->highs.begin(), this->highs.end(), high);
+    const std::size_t i = static_cast<std::size_t>(position - this->highs.begin());
+
+    // First value of its container.
+    if (position == this->highs.end() || *position != high)
+    {
+        this->highs.insert(position, high);
+        this->containers.insert(this->containers.begin() + static_cast<std::ptrdiff_t>(i), Container());
+    }
+
+    Container& container = this->containers[i];
+
+    if (!container.bitset.empty())
+    {
+        std::uint64_t& word = container.bitset[low >> 6];
+        const std::uint64_t bit = std::uint64_t(1) << (low & 63);
+
+        if (word & bit)
+        {
+            return false;
+        }
+
+        word |= bit;
+    }
+
+    else
+    {
+        const auto slot = std::lower_bound(container.array.begin(), container.array.end(), low);
+
+        if (slot != container.array.end() && *slot == low)
+        {
+            return false;
+        }
+
+        // Full; a bitset is now the smaller of the two.
+        if (container.array.size() == sparse)
+        {
+            container.bitset.assign(words, 0);
+
+            for (const std::uint16_t member : container.array)
+            {
+                container.bitset[member >> 6] |= std::uint64_t(1) << (member & 63);
+            }
+
+            container.bitset[low >> 6] |= std::uint64_t(1) << (low & 63);
+
+            std::vector<std::uint16_t>().swap(container.array);
+        }
+
+        else
+        {
+            container.array.insert(slot, low);
+        }
+    }
+
+    container.cardinality++;
+    this->count++;
+
+    return true;
+}
+
+bool Roaring::Remove(std::uint32_t value)
+{
+    const std::uint16_t high = static_cast<std::uint16_t>(value >> 16);
+    const std::uint16_t low = static_cast<std::uint16_t>(value);
+
+    const std::size_t i = Find(high);
+
+    if (i == this->containers.size())
+    {
+        return false;
+    }
+
+    Container& container = this->containers[i];
+
+    if (!container.bitset.empty())
+    {
+        std::uint64_t& word = container.bitset[low >> 6];
+        const std::uint64_t bit = std::uint64_t(1) << (low & 63);
+
+        if (!(word & bit))
+        {
+            return false;
+        }
+
+        word &= ~bit;
+
+        // Sparse again; an array is now well the smaller of the two.
+        if (container.cardinality - 1 == dense)
+        {
+            container.array.reserve(dense);
+
+            for (std::size_t w = 0; w < words; w++)
+            {
+                for (std::uint64_t bits = container.bitset[w]; bits; bits &= bits - 1)
+                {
+                    container.array.push_back(static_cast<std::uint16_t>(w * 64 + __builtin_ctzll(bits)));
+                }
+            }
+
+            std::vector<std::uint64_t>().swap(container.bitset);
+        }
+    }
+
+    else
+    {
+        const auto slot = std::lower_bound(container.array.begin(), container.array.end(), low);
+
+        if (slot == container.array.end() || *slot != low)
+        {
+            return false;
+        }
+
+        container.array.erase(slot);
+    }
+
+    container.cardinality--;
+    this->count--;
+
+    // Last value of its container.
+    if (container.cardinality == 0)
+    {
+        this->highs.erase(this->highs.begin() + static_cast<std::ptrdiff_t>(i));
+        this->containers.erase(this->containers.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    return true;
+}
+
+bool Roaring::Contains(std::uint64_t value) const
+{
+    // Beyond 32 bits; never added.
+    if (value >> 32)
+    {
+        return false;
+    }
+
+    const std::uint16_t low = static_cast<std::uint16_t>(value);
+    const std::size_t i = Find(static_cast<std::uint16_t>(value >> 16));
+
+    if (i == this->containers.size())
+    {
+        return false;
+    }
+
+    const Container& container = this->containers[i];
+
+    if (!container.bitset.empty())
+    {
+        return (container.bitset[low >> 6] >> (low & 63)) & 1;
+    }
+
+    return std::binary_search(container.array.begin(), container.array.end(), low);
+}
+
+std::uint64_t Roaring::Rank(std::uint64_t value) const
+{
+    // Beyond 32 bits; above every value.
+    if (value >> 32)
+    {
+        return this->count;
+    }
+
+    const std::uint16_t high = static_cast<std::uint16_t>(value >> 16);
+    std::uint64_t rank = 0;
+
+    for (std::size_t i = 0; i < this->highs.size() && this->highs[i] <= high; i++)
+    {
+        rank += (this->highs[i] < high)
+            ? this->containers[i].cardinality
+            : Rank(this->containers[i], static_cast<std::uint16_t>(value));
+    }
+
+    return rank;
+}
+
+bool Roaring::Select(std::uint64_t k, std::uint32_t& value) const
+{
+    if (k >= this->count)
+    {
+        return false;
+    }
+
+    // Skip whole containers until the one holding the k-th value.
+    std::size_t i = 0;
+    while (k >= this->containers[i].cardinality)
+    {
+        k -= this->containers[i].cardinality;
+        i++;
+    }
+
+    value = (std::uint32_t(this->highs[i]) << 16) | Select(this->containers[i], static_cast<std::uint32_t>(k));
+
+    return true;
+}
+
+std::uint64_t Roaring::Count() const
+{
+    return this->count;
+}
+
+std::size_t Roaring::Bytes() const
+{
+    std::size_t bytes = sizeof(*this)
+        + this->highs.capacity() * sizeof(std::uint16_t)
+        + this->containers.capacity() * sizeof(Container);
+
+    for (const Container& container : this->containers)
+    {
+        bytes += container.array.capacity() * sizeof(std::uint16_t) + container.bitset.capacity() * sizeof(std::uint64_t);
+    }
+
+    return bytes;
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr std::uint32_t Roaring::sparse;
+
+constexpr std::uint32_t Roaring::dense;
+
+constexpr std::size_t Roaring::words;
+
+//
+// Static Methods
+//
+
+std::uint32_t Roaring::Rank(const Roaring::Container& container, std::uint32_t low)
+{
+    if (container.bitset.empty())
+    {
+        return static_cast<std::uint32_t>(std::lower_bound(container.array.begin(), container.array.end(), low) - container.array.begin());
+    }
+
+    // Whole words below the lower bits, then the bits below it within its own word.
+    std::uint32_t rank = 0;
+
+    for (std::size_t w = 0; w < (low >> 6); w++)
+    {
+        rank += static_cast<std::uint32_t>(__builtin_popcountll(container.bitset[w]));
+    }
+
+    if (low & 63)
+    {
+        rank += static_cast<std::uint32_t>(__builtin_popcountll(container.bitset[low >> 6] & ((std::uint64_t(1) << (low & 63)) - 1)));
+    }
+
+    return rank;
+}
+
+std::uint16_t Roaring::Select(const Roaring::Container& container, std::uint32_t k)
+{
+    if (container.bitset.empty())
+    {
+        return container.array[k];
+    }
+
+    // Skip whole words until the one holding the k-th bit.
+    std::size_t w = 0;
+    std::uint32_t bits = static_cast<std::uint32_t>(__builtin_popcountll(container.bitset[w]));
+
+    while (k >= bits)
+    {
+        k -= bits;
+        bits = static_cast<std::uint32_t>(__builtin_popcountll(container.bitset[++w]));
+    }
+
+    // Drop the k lowest set bits; the lowest one left is the k-th.
+    std::uint64_t word = container.bitset[w];
+    for (; k > 0; k--)
+    {
+        word &= word - 1;
+    }
+
+    return static_cast<std::uint16_t>(w * 64 + __builtin_ctzll(word));
+}
+
+//
+// Methods
+//
+
+std::size_t Roaring::Find(std::uint16_t high) const
+{
+    const auto position = std::lower_bound(this->highs.begin(), this->highs.end(), high);
+
+    if (position == this->highs.end() || *position != high)
+    {
+        return this->highs.size();
+    }
+
+    return static_cast<std::size_t>(position - this->highs.begin());
+}
+
+void Roaring::Fill(const Node* root)
+{
+    // Base case.
+    if (!root)
+    {
+        return;
+    }
+
+    Fill(root->nodeL);
+    Add(static_cast<std::uint32_t>(root->value));
+    Fill(root->nodeR);
+}
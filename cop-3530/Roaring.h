@@ -0,0 +1,220 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_ROARING_H
+#define PROJECT_1_ROARING_H
+
+// std...
+#include <cstdint>
+#include <vector>
+
+// custom...
+#include "Node.h"
+
+/**
+ * @class Roaring
+ *
+ * @brief Represents a compressed bitmap of 32-bit values, used to know which IDs a tree holds
+ * without touching its nodes.
+ *
+ * The values are split by their upper 16 bits into containers, kept sorted by those bits. Each
+ * container holds the lower 16 bits of its values either as a sorted array, while sparse, or as a
+ * 65,536-bit bitset once it holds more than 4,096 of them, whichever is smaller; it's turned back
+ * into an array only once it falls to 2,048, so values added and removed around the threshold
+ * don't convert it back and forth.
+ *
+ * Every 8-digit ID falls in one of 1,526 containers, so ranks and selects sum at most that many
+ * cardinalities before searching a single container.
+ */
+class Roaring
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs an empty bitmap.
+     *
+     * Time complexity: O(1)
+     */
+    Roaring() = default;
+
+    /**
+     * @brief Constructs a bitmap of every value of the tree rooted at the given node.
+     *
+     * @param root The root of the tree to be read.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    explicit Roaring(const Node* root);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Adds the given value.
+     *
+     * @return `false` if the value was already present, `true` otherwise.
+     *
+     * Time complexity: O(c + a) where c is the number of containers and a the size of an array container.
+     */
+    bool Add(std::uint32_t value);
+
+    /**
+     * @brief Removes the given value.
+     *
+     * @return `false` if the value wasn't present, `true` otherwise.
+     *
+     * Time complexity: O(c + a) where c is the number of containers and a the size of an array container.
+     */
+    bool Remove(std::uint32_t value);
+
+    /**
+     * @brief Checks if the given value is present.
+     *
+     * Time complexity: O(log c + log a) where c is the number of containers and a the size of an array container.
+     */
+    bool Contains(std::uint64_t value) const;
+
+    /**
+     * @brief Returns the number of values present below the given value.
+     *
+     * Time complexity: O(c + a) where c is the number of containers and a the size of an array container.
+     */
+    std::uint64_t Rank(std::uint64_t value) const;
+
+    /**
+     * @brief Finds the k-th smallest value present, counting from zero.
+     *
+     * @param k The number of values below the one sought.
+     * @param value Set to the value, if found.
+     *
+     * @return `false` if fewer than `k + 1` values are present, `true` otherwise.
+     *
+     * Time complexity: O(c) where c is the number of containers.
+     */
+    bool Select(std::uint64_t k, std::uint32_t& value) const;
+
+    /**
+     * @brief Returns the number of values present.
+     *
+     * Time complexity: O(1)
+     */
+    std::uint64_t Count() const;
+
+    /**
+     * @brief Returns the number of bytes held, the bitmap itself included.
+     *
+     * Time complexity: O(c) where c is the number of containers.
+     */
+    std::size_t Bytes() const;
+
+private:
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the most values an array container holds.
+     */
+    static constexpr std::uint32_t sparse = 4096;
+
+    /**
+     * @brief Represents the number of values a bitset container falls to before it's turned back into an array.
+     */
+    static constexpr std::uint32_t dense = 2048;
+
+    /**
+     * @brief Represents the number of 64-bit words of a bitset container.
+     */
+    static constexpr std::size_t words = 1024;
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Container
+     * @brief Represents the lower 16 bits of the values sharing the same upper 16 bits.
+     */
+    struct Container
+    {
+        /**
+         * @brief The lower bits, sorted; used while `bitset` is empty.
+         */
+        std::vector<std::uint16_t> array;
+
+        /**
+         * @brief A bit per lower bits, set if present; empty while `array` is used.
+         */
+        std::vector<std::uint64_t> bitset;
+
+        /**
+         * @brief The number of values held.
+         */
+        std::uint32_t cardinality = 0;
+    };
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Returns the number of values of the container below the given lower bits.
+     *
+     * Time complexity: O(a) where a is the size of an array container.
+     */
+    static std::uint32_t Rank(const Container& container, std::uint32_t low);
+
+    /**
+     * @brief Returns the lower bits of the k-th smallest value of the container, counting from zero.
+     *
+     * Time complexity: O(a) where a is the size of an array container.
+     */
+    static std::uint16_t Select(const Container& container, std::uint32_t k);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Returns the index of the container for the given upper bits, or the number of
+     * containers if there's none.
+     *
+     * Time complexity: O(log c) where c is the number of containers.
+     */
+    std::size_t Find(std::uint16_t high) const;
+
+    /**
+     * @brief Adds every value of the tree rooted at the given node.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree, as they're added in order.
+     */
+    void Fill(const Node* root);
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the upper bits of each container, sorted.
+     */
+    std::vector<std::uint16_t> highs;
+
+    /**
+     * @brief Represents the containers, in the same order as `highs`.
+     */
+    std::vector<Container> containers;
+
+    /**
+     * @brief Represents the number of values present.
+     */
+    std::uint64_t count = 0;
+};
+
+#endif //PROJECT_1_ROARING_H
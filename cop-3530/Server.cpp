@@ -0,0 +1,440 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+// sys...
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// custom...
+#include "Clap.h"
+#include "Server.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Static Methods
+//
+
+bool Server::Run(const std::string& path, unsigned int threads)
+{
+    listener = Listen(path);
+    if (listener < 0)
+    {
+        std::cerr << "unable to listen on " << path << std::endl;
+
+        return false;
+    }
+
+    poll = epoll_create1(EPOLL_CLOEXEC);
+    if (poll < 0)
+    {
+        close(listener);
+
+        return false;
+    }
+
+    stop = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (stop < 0)
+    {
+        close(poll);
+        close(listener);
+
+        return false;
+    }
+
+    // The listener stays armed; racing threads simply find nothing to accept.
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = listener;
+    epoll_ctl(poll, EPOLL_CTL_ADD, listener, &event);
+
+    // Never read, so once signaled, it wakes every thread in turn.
+    event.data.fd = stop;
+    epoll_ctl(poll, EPOLL_CTL_ADD, stop, &event);
+
+    struct sigaction action{};
+    struct sigaction interrupt{};
+    struct sigaction terminate{};
+    action.sa_handler = Stop;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, &interrupt);
+    sigaction(SIGTERM, &action, &terminate);
+
+    std::vector<std::thread> workers;
+    for (unsigned int i = 1; i < threads; i++)
+    {
+        workers.emplace_back(Serve);
+    }
+
+    // The calling thread serves as well.
+    Serve();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    sigaction(SIGINT, &interrupt, nullptr);
+    sigaction(SIGTERM, &terminate, nullptr);
+
+    // No thread serves anymore; send what the socket accepts of the queued replies, then hang up.
+    for (auto& entry : clients)
+    {
+        Send(entry.first, *entry.second);
+        close(entry.first);
+    }
+
+    clients.clear();
+
+    close(stop);
+    close(poll);
+    close(listener);
+    unlink(path.c_str());
+
+    return true;
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+int Server::listener = -1;
+
+int Server::poll = -1;
+
+int Server::stop = -1;
+
+Server::Clients Server::clients;
+
+std::mutex Server::mutex;
+
+constexpr std::size_t Server::longest;
+
+constexpr std::size_t Server::backlog;
+
+//
+// Static Methods
+//
+
+int Server::Listen(const std::string& path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+
+    // Leave room for the null terminator.
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        return -1;
+    }
+
+    path.copy(address.sun_path, path.size());
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    // Replace a stale socket left behind by a previous server.
+    unlink(path.c_str());
+
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(fd, SOMAXCONN) < 0)
+    {
+        close(fd);
+
+        return -1;
+    }
+
+    return fd;
+}
+
+void Server::Serve()
+{
+    epoll_event events[64];
+    bool stopping = false;
+
+    while (!stopping)
+    {
+        const int ready = epoll_wait(poll, events, 64, -1);
+
+        // Interrupted by a signal; try again.
+        if (ready < 0)
+        {
+            continue;
+        }
+
+        for (int i = 0; i < ready; i++)
+        {
+            const int fd = events[i].data.fd;
+
+            if (fd == listener)
+            {
+                Accept();
+
+                continue;
+            }
+
+            // Finish handling the events already delivered, then stop.
+            if (fd == stop)
+            {
+                stopping = true;
+
+                continue;
+            }
+
+            Client* client;
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+
+                client = clients.at(fd).get();
+            }
+
+            bool open = true;
+
+            if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+            {
+                open = Receive(fd, *client);
+            }
+
+            // Flush the replies, even if the client stopped sending after its last command.
+            if (open && !client->output.empty())
+            {
+                open = Send(fd, *client);
+            }
+
+            if (!open || (client->closing && client->output.empty()))
+            {
+                Close(fd);
+            }
+
+            else
+            {
+                Arm(fd, *client);
+            }
+        }
+    }
+}
+
+void Server::Accept()
+{
+    while (true)
+    {
+        const int fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+        // No more pending connections.
+        if (fd < 0)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+
+            clients[fd].reset(new Client());
+        }
+
+        // Register only once the client is known, as another thread may receive its first event.
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLONESHOT;
+        event.data.fd = fd;
+
+        if (epoll_ctl(poll, EPOLL_CTL_ADD, fd, &event) < 0)
+        {
+            Close(fd);
+        }
+    }
+}
+
+bool Server::Receive(int fd, Server::Client& client)
+{
+    bool open = true;
+    char buffer[4096];
+
+    // The bytes received since the last newline; whatever's left in the input never has one.
+    std::size_t pending = client.input.size();
+
+    // Past a line's worth of input, or with too many replies unsent, leave the rest in the socket for later.
+    while (!client.closing && client.input.size() <= longest && client.output.size() < backlog)
+    {
+        const ssize_t size = read(fd, buffer, sizeof(buffer));
+
+        if (size > 0)
+        {
+            client.input.append(buffer, static_cast<std::size_t>(size));
+
+            std::size_t last = static_cast<std::size_t>(size);
+            while (last > 0 && buffer[last - 1] != '\n')
+            {
+                last--;
+            }
+
+            pending = (last > 0) ? static_cast<std::size_t>(size) - last : pending + static_cast<std::size_t>(size);
+
+            // No command is ever that long; drop the client rather than buffer it without end.
+            if (pending > longest)
+            {
+                open = false;
+
+                break;
+            }
+        }
+
+        // Drained everything available for now.
+        else if (size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+
+        else if (size < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        // Finished sending; still answer whatever was received.
+        else if (size == 0)
+        {
+            client.closing = true;
+        }
+
+        else
+        {
+            open = false;
+
+            break;
+        }
+    }
+
+    std::ostringstream replies;
+    std::ostream* previous = Node::Redirect(&replies);
+
+    // Commands act on the connection's own transaction.
+    Clap::Transaction* transaction = Clap::transaction;
+    Clap::transaction = &client.transaction;
+
+    std::size_t start = 0;
+    std::size_t end;
+
+    // Execute every complete line in the order received.
+    while ((end = client.input.find('\n', start)) != std::string::npos)
+    {
+        std::string line = client.input.substr(start, end - start);
+
+        // Tolerate clients sending `\r\n`.
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        start = end + 1;
+
+        // Blank lines aren't commands; don't let them take the writers' lock.
+        if (line.find_first_not_of(" \t") == std::string::npos)
+        {
+            continue;
+        }
+
+        Clap::Command command;
+        Clap::Args args;
+
+        Clap::Split(line, command, args);
+        Clap::Execute(command, args);
+    }
+
+    Clap::transaction = transaction;
+    Node::Redirect(previous);
+
+    client.input.erase(0, start);
+    client.output.append(replies.str());
+
+    return open;
+}
+
+bool Server::Send(int fd, Server::Client& client)
+{
+    std::size_t sent = 0;
+
+    while (sent < client.output.size())
+    {
+        const ssize_t size = send(fd, client.output.data() + sent, client.output.size() - sent, MSG_NOSIGNAL);
+
+        if (size >= 0)
+        {
+            sent += static_cast<std::size_t>(size);
+        }
+
+        // The socket is full; wait until it drains.
+        else if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            break;
+        }
+
+        else if (errno != EINTR)
+        {
+            return false;
+        }
+    }
+
+    client.output.erase(0, sent);
+
+    return true;
+}
+
+void Server::Arm(int fd, const Server::Client& client)
+{
+    // A client not reading its replies isn't read from either, until the socket drains some of them.
+    const bool reading = !client.closing && client.output.size() < backlog;
+
+    epoll_event event{};
+    event.events = EPOLLONESHOT | (reading ? EPOLLIN : 0u) | (client.output.empty() ? 0u : EPOLLOUT);
+    event.data.fd = fd;
+
+    // Under the mutex, so the thread the next event is delivered to, which looks the client up under it,
+    // sees everything done to the client before.
+    std::lock_guard<std::mutex> guard(mutex);
+
+    epoll_ctl(poll, EPOLL_CTL_MOD, fd, &event);
+}
+
+void Server::Stop(int)
+{
+    const std::uint64_t one = 1;
+
+    // Only async-signal-safe calls here; the serving threads do the rest.
+    ssize_t written = write(stop, &one, sizeof(one));
+    (void) written;
+}
+
+void Server::Close(int fd)
+{
+    epoll_ctl(poll, EPOLL_CTL_DEL, fd, nullptr);
+
+    // Forget the client before its descriptor can be reused by a new connection.
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+
+        clients.erase(fd);
+    }
+
+    close(fd);
+}
@@ -0,0 +1,231 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_SERVER_H
+#define PROJECT_1_SERVER_H
+
+// std...
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// custom...
+#include "Clap.h"
+
+/**
+ * @class Server
+ *
+ * @brief Serves the command language of the Command Line Argument Parser (C.L.A.P.) over a
+ * Unix domain socket, keeping one long-lived tree in memory for every client.
+ *
+ * Clients send one command per line, without the leading command count the standard input
+ * expects. Each command's output is sent back exactly as it would have been printed, and in
+ * the order the commands were received. Clients may pipeline: any number of commands can be
+ * sent before reading the replies. Blank lines are ignored, and a client sending a line longer
+ * than `longest` is disconnected, so none can buffer input without end.
+ *
+ * All clients are multiplexed through a single `epoll` instance using non-blocking sockets,
+ * which a pool of threads waits on. Clients are registered as one-shot, so each client is
+ * handled by at most one thread at a time (keeping its replies in order) while different
+ * clients' reader commands run in parallel.
+ *
+ * A client is only read from while fewer than `backlog` bytes of its replies remain unsent, so one
+ * pipelining commands without reading the replies can't make the server buffer them without end;
+ * it's read from again once the socket drains them.
+ *
+ * Interrupting or terminating the server (SIGINT or SIGTERM) stops every thread once it's done with
+ * the events already delivered to it, and closes every connection, so the caller can tear down.
+ */
+class Server
+{
+public:
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Binds a Unix domain socket at the given path and serves clients until interrupted or
+     * terminated. Any stale socket file at the path is replaced, and the socket file is removed once
+     * every thread has stopped.
+     *
+     * @param path The filesystem path of the socket.
+     * @param threads The number of threads serving clients.
+     *
+     * @return `false` if the socket couldn't be set up, `true` once stopped.
+     *
+     * Time complexity: O(n) per event where n is the number of commands received.
+     */
+    static bool Run(const std::string& path, unsigned int threads);
+
+private:
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Client
+     * @brief Represents the buffered state of a single connection.
+     */
+    struct Client
+    {
+        /**
+         * @brief Bytes received but not yet forming a complete line.
+         */
+        std::string input;
+
+        /**
+         * @brief Replies produced but not yet sent.
+         */
+        std::string output;
+
+        /**
+         * @brief Whether the client finished sending, so the connection closes once its replies are sent.
+         */
+        bool closing = false;
+
+        /**
+         * @brief The connection's transaction, if it began one.
+         */
+        Clap::Transaction transaction;
+    };
+
+    //
+    // Typedefs
+    //
+
+    /**
+     * @typedef Clients
+     * @brief Represents the connected clients keyed by their file descriptors.
+     * The clients are of type `std::unordered_map<int, std::unique_ptr<Client>>`.
+     */
+    using Clients = std::unordered_map<int, std::unique_ptr<Client>>;
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Creates, binds, and listens on a non-blocking Unix domain socket.
+     *
+     * @param path The filesystem path of the socket.
+     *
+     * @return The listening file descriptor, or `-1` on failure.
+     *
+     * Time complexity: O(1)
+     */
+    static int Listen(const std::string& path);
+
+    /**
+     * @brief Waits for and handles events until stopped. Run by every serving thread.
+     *
+     * Time complexity: O(n) per event where n is the number of commands received.
+     */
+    static void Serve();
+
+    /**
+     * @brief Accepts every pending connection and registers it with the `epoll` instance.
+     *
+     * Time complexity: O(n) where n is the number of pending connections.
+     */
+    static void Accept();
+
+    /**
+     * @brief Reads what's available from the client, while no more than `longest` bytes are buffered
+     * and fewer than `backlog` bytes of replies remain, and executes each complete line, queueing the
+     * replies. Marks the client as closing once it finished sending.
+     *
+     * @param fd The client's file descriptor.
+     * @param client The client's buffered state.
+     *
+     * @return `false` if the connection errored, or sent a line longer than `longest`, `true` otherwise.
+     *
+     * Time complexity: O(n) where n is the number of commands received.
+     */
+    static bool Receive(int fd, Client& client);
+
+    /**
+     * @brief Sends as much of the client's queued replies as the socket accepts.
+     *
+     * @param fd The client's file descriptor.
+     * @param client The client's buffered state.
+     *
+     * @return `false` if the client disconnected or errored, `true` otherwise.
+     *
+     * Time complexity: O(n) where n is the number of bytes queued.
+     */
+    static bool Send(int fd, Client& client);
+
+    /**
+     * @brief Re-arms the client's one-shot registration, watching for writability only while
+     * replies remain, and for readability only while the client isn't closing and fewer than
+     * `backlog` bytes of replies remain.
+     *
+     * @param fd The client's file descriptor.
+     * @param client The client's buffered state.
+     *
+     * Time complexity: O(1)
+     */
+    static void Arm(int fd, const Client& client);
+
+    /**
+     * @brief Signals every serving thread to stop. Installed as the SIGINT and SIGTERM handler while serving.
+     *
+     * Time complexity: O(1)
+     */
+    static void Stop(int);
+
+    /**
+     * @brief Unregisters, forgets, and closes the client's connection.
+     *
+     * @param fd The client's file descriptor.
+     *
+     * Time complexity: O(1)
+     */
+    static void Close(int fd);
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the listening file descriptor.
+     */
+    static int listener;
+
+    /**
+     * @brief Represents the `epoll` file descriptor shared by every serving thread.
+     */
+    static int poll;
+
+    /**
+     * @brief Represents the `eventfd` signaled once the server is to stop, watched by every serving thread.
+     */
+    static int stop;
+
+    /**
+     * @brief Represents the connected clients.
+     */
+    static Clients clients;
+
+    /**
+     * @brief Guards `clients`. A client's own state is only touched by the thread its event was delivered to,
+     * and handed over to the next one through it.
+     */
+    static std::mutex mutex;
+
+    /**
+     * @brief Represents the number of bytes of the longest line a client may send.
+     */
+    static constexpr std::size_t longest = 1 << 16;
+
+    /**
+     * @brief Represents the number of bytes of unsent replies past which a client isn't read from.
+     */
+    static constexpr std::size_t backlog = 1 << 20;
+};
+
+#endif //PROJECT_1_SERVER_H
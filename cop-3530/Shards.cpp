@@ -0,0 +1,285 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <sstream>
+
+// custom...
+#include "Shards.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Shards::Shards(unsigned int n)
+{
+    n = std::max(1u, n);
+
+    // Round up, so the last shard ends at 99,999,999.
+    this->width = (100000000 + n - 1) / n;
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+        this->shards.emplace_back(new Shard());
+
+        Shard& shard = *this->shards.back();
+        shard.worker = std::thread(Work, std::ref(shard));
+    }
+}
+
+Shards::~Shards()
+{
+    for (auto& shard : this->shards)
+    {
+        {
+            std::lock_guard<std::mutex> guard(shard->mutex);
+
+            shard->stopping = true;
+        }
+
+        shard->ready.notify_one();
+        shard->worker.join();
+    }
+}
+
+//
+// Methods
+//
+
+void Shards::Insert(const Node::Value& value, const Node::Label& label)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    const std::size_t index = Route(value);
+    std::size_t& size = this->shards[index]->size;
+
+    Echo(Submit(index, [value, label, &size](Tree& tree)
+    {
+        // Values must be unique; only absent ones are counted.
+        size += !tree.Find(value);
+
+        return Capture([&]() { tree.Insert(value, label); });
+    }).get());
+}
+
+void Shards::Remove(const Node::Value& value)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    const std::size_t index = Route(value);
+    std::size_t& size = this->shards[index]->size;
+
+    Echo(Submit(index, [value, &size](Tree& tree)
+    {
+        size -= tree.Find(value) != nullptr;
+
+        return Capture([&]() { tree.Remove(value); });
+    }).get());
+}
+
+void Shards::Remove(unsigned int n)
+{
+    std::unique_lock<std::shared_timed_mutex> guard(this->lock);
+
+    // Select the shard holding the n-th value.
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < this->shards.size(); i++)
+    {
+        std::size_t& size = this->shards[i]->size;
+
+        if (n - offset < size)
+        {
+            const unsigned int local = static_cast<unsigned int>(n - offset);
+
+            Echo(Submit(i, [local, &size](Tree& tree)
+            {
+                size--;
+
+                return Capture([&]() { tree.Remove(local); });
+            }).get());
+
+            return;
+        }
+
+        offset += size;
+    }
+
+    // N-th position unobtainable; unsuccessful remove!
+    Node::PrintFailure();
+}
+
+void Shards::Search(const Node::Value& value)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    Echo(Submit(Route(value), [value](Tree& tree)
+    {
+        return Capture([&]() { tree.Search(value); });
+    }).get());
+}
+
+void Shards::Search(const Node::Label& label)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    Intern::Handle handle;
+
+    // Never interned; no shard has it.
+    if (!Intern::Find(label, handle))
+    {
+        Node::PrintFailure();
+
+        return;
+    }
+
+    std::vector<std::future<std::string>> results;
+    for (std::size_t i = 0; i < this->shards.size(); i++)
+    {
+        results.push_back(Submit(i, [handle](Tree& tree)
+        {
+            std::string output;
+            Node::Search(tree.Root(), handle, output);
+
+            return output;
+        }));
+    }
+
+    // The shards are in value order; concatenating keeps it.
+    std::string result;
+    for (auto& output : results)
+    {
+        result.append(output.get());
+    }
+
+    if (!result.empty())
+    {
+        // Print, but remove the last newline insertion.
+        Node::Print(result.substr(0, result.rfind('\n')));
+    }
+
+    else
+    {
+        Node::PrintFailure();
+    }
+}
+
+void Shards::Print(Node::Order order)
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    std::vector<std::future<std::string>> results;
+    for (std::size_t i = 0; i < this->shards.size(); i++)
+    {
+        results.push_back(Submit(i, [order](Tree& tree)
+        {
+            std::string output;
+            Node::Traverse(tree.Root(), order, output);
+
+            return output;
+        }));
+    }
+
+    // The shards are in value order; concatenating keeps it.
+    std::string result;
+    for (auto& output : results)
+    {
+        result.append(output.get());
+    }
+
+    if (!result.empty())
+    {
+        // Print, but remove the last ", " comma insertion.
+        Node::Print(result.substr(0, result.rfind(',')));
+    }
+
+    else
+    {
+        Node::Print(result);
+    }
+}
+
+void Shards::Print()
+{
+    std::shared_lock<std::shared_timed_mutex> guard(this->lock);
+
+    std::vector<std::future<Node::Cache>> heights;
+    for (std::size_t i = 0; i < this->shards.size(); i++)
+    {
+        heights.push_back(Submit(i, [](Tree& tree) { return Node::Height(tree.Root()); }));
+    }
+
+    Node::Cache height = 0;
+    for (auto& shard : heights)
+    {
+        height = std::max(height, shard.get());
+    }
+
+    Node::Print(std::to_string(height));
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Static Methods
+//
+
+void Shards::Work(Shards::Shard& shard)
+{
+    while (true)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> guard(shard.mutex);
+            shard.ready.wait(guard, [&]() { return shard.stopping || !shard.tasks.empty(); });
+
+            if (shard.tasks.empty())
+            {
+                return;
+            }
+
+            task = std::move(shard.tasks.front());
+            shard.tasks.pop_front();
+        }
+
+        task();
+    }
+}
+
+std::string Shards::Capture(const std::function<void()>& function)
+{
+    std::ostringstream output;
+    std::ostream* previous = Node::Redirect(&output);
+
+    function();
+
+    Node::Redirect(previous);
+
+    return output.str();
+}
+
+void Shards::Echo(const std::string& output)
+{
+    // Every `Node` print ends with a newline; `Node::Print` adds it back.
+    Node::Print(output.substr(0, output.size() - 1));
+}
+
+//
+// Methods
+//
+
+std::size_t Shards::Route(const Node::Value& value) const
+{
+    // Values out of range can't be stored anywhere; send them to the last shard to fail there.
+    return static_cast<std::size_t>(std::min<Node::Value>(value / this->width, this->shards.size() - 1));
+}
@@ -0,0 +1,224 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_SHARDS_H
+#define PROJECT_1_SHARDS_H
+
+// std...
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// custom...
+#include "Engine.h"
+#include "Tree.h"
+
+/**
+ * @class Shards
+ *
+ * @brief Represents an engine partitioning the `0..99,999,999` value space into contiguous ranges,
+ * each stored in an independent AVL tree owned by its own worker thread.
+ *
+ * Point operations are routed to the shard owning the value and run on its worker, so operations
+ * on different shards proceed in parallel while each shard stays single-threaded. Since the ranges
+ * are contiguous, global in-order results are simply the shards' results concatenated in order;
+ * label searches and prints fan out to every shard at once. `removeInorder` selects the shard
+ * holding the n-th value from the sizes the workers keep of their shards, excluding every other
+ * operation meanwhile.
+ *
+ * As the shards are separate trees, pre-order and post-order prints list each shard's traversal
+ * in shard order, and the level count is that of the tallest shard.
+ */
+class Shards : public Engine
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs the given number of empty shards and starts their workers.
+     *
+     * @param n The number of shards, at least one.
+     *
+     * Time complexity: O(n)
+     */
+    explicit Shards(unsigned int n);
+
+    /**
+     * @brief Stops the workers and destroys every shard.
+     *
+     * Time complexity: O(n) where n is the number of values stored.
+     */
+    ~Shards() override;
+
+    //
+    // Methods
+    //
+
+    void Insert(const Node::Value& value, const Node::Label& label) override;
+
+    void Remove(const Node::Value& value) override;
+
+    void Remove(unsigned int n) override;
+
+    void Search(const Node::Value& value) override;
+
+    void Search(const Node::Label& label) override;
+
+    void Print(Node::Order order) override;
+
+    void Print() override;
+
+private:
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Shard
+     * @brief Represents a single shard: its tree, and the queue its worker drains.
+     */
+    struct Shard
+    {
+        /**
+         * @brief The shard's tree. Only touched by the shard's worker.
+         */
+        Tree tree;
+
+        /**
+         * @brief The number of values in the shard's tree. Only written by the shard's worker, and
+         * only read by `removeInorder` once every other operation is done.
+         */
+        std::size_t size = 0;
+
+        /**
+         * @brief The tasks awaiting the worker.
+         */
+        std::deque<std::function<void()>> tasks;
+
+        /**
+         * @brief Guards `tasks` and `stopping`.
+         */
+        std::mutex mutex;
+
+        /**
+         * @brief Signalled when a task is queued or the worker must stop.
+         */
+        std::condition_variable ready;
+
+        /**
+         * @brief Whether the worker must stop once the queue is drained.
+         */
+        bool stopping = false;
+
+        /**
+         * @brief The worker owning the shard.
+         */
+        std::thread worker;
+    };
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Drains the shard's queue until asked to stop. Run by every worker.
+     *
+     * @param shard The shard owned by the worker.
+     */
+    static void Work(Shard& shard);
+
+    /**
+     * @brief Runs the given function, capturing everything it prints.
+     *
+     * @param function The function to be run.
+     *
+     * @return What the function printed.
+     */
+    static std::string Capture(const std::function<void()>& function);
+
+    /**
+     * @brief Prints output captured from a worker, as if it had been printed by the calling thread.
+     *
+     * @param output The captured output.
+     */
+    static void Echo(const std::string& output);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Queues the given function on the given shard's worker.
+     *
+     * @param index The index of the shard.
+     * @param function The function to be run with the shard's tree.
+     *
+     * @return The future result of the function.
+     */
+    template <typename Function>
+    auto Submit(std::size_t index, Function function) -> std::future<decltype(function(std::declval<Tree&>()))>
+    {
+        using Result = decltype(function(std::declval<Tree&>()));
+
+        Shard& shard = *shards[index];
+        auto task = std::make_shared<std::packaged_task<Result()>>([&shard, function]() mutable
+        {
+            return function(shard.tree);
+        });
+
+        {
+            std::lock_guard<std::mutex> guard(shard.mutex);
+
+            shard.tasks.emplace_back([task]() { (*task)(); });
+        }
+
+        shard.ready.notify_one();
+
+        return task->get_future();
+    }
+
+    /**
+     * @brief Returns the index of the shard owning the given value.
+     *
+     * @param value The value to be routed.
+     *
+     * @return The index of the shard.
+     *
+     * Time complexity: O(1)
+     */
+    std::size_t Route(const Node::Value& value) const;
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the shards, in value order.
+     */
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    /**
+     * @brief Represents the number of values in each shard's range.
+     */
+    Node::Value width;
+
+    /**
+     * @brief Held shared by every operation but `removeInorder`, which needs the sizes of all
+     * shards to stay put until its removal is done.
+     */
+    std::shared_timed_mutex lock;
+};
+
+#endif //PROJECT_1_SHARDS_H
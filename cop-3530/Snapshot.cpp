@@ -0,0 +1,288 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <limits>
+
+// custom...
+#include "Snapshot.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Static Methods
+//
+
+bool Snapshot::Save(const Node* root, std::ostream& stream)
+{
+    std::vector<Node*> nodes;
+    Node::Traverse(const_cast<Node*>(root), Node::Order::LNR, nodes);
+
+    // Collect the distinct labels in sorted order.
+    Dictionary dictionary;
+    dictionary.reserve(nodes.size());
+
+    for (const Node* node : nodes)
+    {
+        dictionary.push_back(Intern::Get(node->label));
+    }
+
+    std::sort(dictionary.begin(), dictionary.end());
+    dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+
+    stream.write("UFS1", 4);
+    Write(stream, nodes.size());
+    Write(stream, dictionary.size());
+
+    // Front-code the dictionary against the previous entry.
+    const Node::Label* previous = nullptr;
+    for (const Node::Label& label : dictionary)
+    {
+        std::size_t shared = 0;
+        if (previous)
+        {
+            const std::size_t limit = std::min(previous->size(), label.size());
+            while (shared < limit && (*previous)[shared] == label[shared])
+            {
+                shared++;
+            }
+        }
+
+        Write(stream, shared);
+        Write(stream, label.size() - shared);
+        stream.write(label.data() + shared, static_cast<std::streamsize>(label.size() - shared));
+
+        previous = &label;
+    }
+
+    // Delta-code the in-order values.
+    Node::Value last = 0;
+    for (const Node* node : nodes)
+    {
+        const auto index = std::lower_bound(dictionary.begin(), dictionary.end(), Intern::Get(node->label)) - dictionary.begin();
+
+        Write(stream, node->value - last);
+        Write(stream, static_cast<unsigned long long>(index));
+
+        last = node->value;
+    }
+
+    stream.flush();
+
+    return static_cast<bool>(stream);
+}
+
+bool Snapshot::Load(std::istream& stream, Tree& tree)
+{
+    char magic[4];
+    if (!stream.read(magic, 4) || std::string(magic, 4) != "UFS1")
+    {
+        return false;
+    }
+
+    unsigned long long n;
+    unsigned long long d;
+    if (!Read(stream, n) || !Read(stream, d) || n > capacity || d > n)
+    {
+        return false;
+    }
+
+    // Every dictionary entry and node record takes at least two bytes; don't allocate for more than there are.
+    const unsigned long long remaining = Remaining(stream);
+
+    if (2 * (n + d) > remaining)
+    {
+        return false;
+    }
+
+    // Expand the front-coded dictionary.
+    Dictionary dictionary;
+    dictionary.reserve(static_cast<std::size_t>(d));
+
+    for (unsigned long long i = 0; i < d; i++)
+    {
+        unsigned long long shared;
+        unsigned long long suffix;
+        if (!Read(stream, shared) || !Read(stream, suffix) || suffix > remaining)
+        {
+            return false;
+        }
+
+        // The shared prefix can't exceed the previous entry.
+        if ((dictionary.empty() && shared > 0) || (!dictionary.empty() && shared > dictionary.back().size()))
+        {
+            return false;
+        }
+
+        Node::Label label = (shared > 0) ? dictionary.back().substr(0, shared) : Node::Label();
+        label.resize(shared + suffix);
+
+        if (!stream.read(&label[shared], static_cast<std::streamsize>(suffix)))
+        {
+            return false;
+        }
+
+        dictionary.push_back(std::move(label));
+    }
+
+    // Intern each distinct label once, rather than once per node.
+    std::vector<Intern::Handle> labels;
+    labels.reserve(dictionary.size());
+
+    for (const Node::Label& label : dictionary)
+    {
+        labels.push_back(Intern::Add(label));
+    }
+
+    Node::Value previous = 0;
+    bool first = true;
+    Node* result = nullptr;
+
+    if (!Build(stream, labels, n, previous, first, result))
+    {
+        return false;
+    }
+
+    // The tree's previous nodes go with the decoded ones' temporary owner.
+    Tree decoded(result);
+    tree.Swap(decoded);
+
+    return true;
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr unsigned long long Snapshot::capacity;
+
+//
+// Static Methods
+//
+
+void Snapshot::Write(std::ostream& stream, unsigned long long number)
+{
+    char bytes[10];
+    int size = 0;
+
+    do
+    {
+        bytes[size] = static_cast<char>(number & 0x7F);
+        number >>= 7;
+
+        if (number)
+        {
+            bytes[size] = static_cast<char>(bytes[size] | 0x80);
+        }
+
+        size++;
+    }
+    while (number);
+
+    stream.write(bytes, size);
+}
+
+bool Snapshot::Read(std::istream& stream, unsigned long long& number)
+{
+    number = 0;
+
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        const int byte = stream.get();
+
+        // Stream ended mid-varint.
+        if (byte == std::istream::traits_type::eof())
+        {
+            return false;
+        }
+
+        number |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+
+        if (!(byte & 0x80))
+        {
+            return true;
+        }
+    }
+
+    // Too many continuation bytes.
+    return false;
+}
+
+unsigned long long Snapshot::Remaining(std::istream& stream)
+{
+    const std::istream::pos_type position = stream.tellg();
+
+    // Not seekable; only the reads themselves can tell.
+    if (position == std::istream::pos_type(-1))
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+
+    stream.seekg(0, std::ios::end);
+    const std::istream::pos_type end = stream.tellg();
+    stream.seekg(position);
+
+    return (end == std::istream::pos_type(-1)) ? std::numeric_limits<unsigned long long>::max()
+        : static_cast<unsigned long long>(end - position);
+}
+
+bool Snapshot::Build(std::istream& stream, const std::vector<Intern::Handle>& labels, unsigned long long n,
+                     Node::Value& previous, bool& first, Node*& root)
+{
+    // Base case.
+    if (n == 0)
+    {
+        root = nullptr;
+
+        return true;
+    }
+
+    Node* nodeL = nullptr;
+    if (!Build(stream, labels, n / 2, previous, first, nodeL))
+    {
+        return false;
+    }
+
+    unsigned long long delta;
+    unsigned long long index;
+
+    // Values must be strictly increasing 8-digit values, and labels must exist.
+    if (!Read(stream, delta) || !Read(stream, index) || index >= labels.size() || (!first && delta == 0)
+        || delta > 99999999 - previous)
+    {
+        Node::Clear(nodeL);
+
+        return false;
+    }
+
+    previous += delta;
+    first = false;
+
+    Node* node = new Node(previous, labels[static_cast<std::size_t>(index)]);
+    node->nodeL = nodeL;
+
+    if (!Build(stream, labels, n - n / 2 - 1, previous, first, node->nodeR))
+    {
+        Node::Clear(node);
+
+        return false;
+    }
+
+    // Update the cache; the tree is perfectly balanced, so its heights are valid ranks too.
+    node->cache = Node::Max(node) + 1;
+    node->rank = node->cache;
+
+    root = node;
+
+    return true;
+}
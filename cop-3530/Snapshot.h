@@ -0,0 +1,148 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_SNAPSHOT_H
+#define PROJECT_1_SNAPSHOT_H
+
+// std...
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// custom...
+#include "Node.h"
+#include "Tree.h"
+
+/**
+ * @class Snapshot
+ *
+ * @brief Encodes the AVL tree into a compact binary snapshot and decodes it back.
+ *
+ * A snapshot is laid out as follows, where every integer is an unsigned LEB128 varint:
+ * - The magic bytes `UFS1`.
+ * - The number of nodes, followed by the number of distinct labels.
+ * - The label dictionary, sorted and front-coded: each entry stores the length of the prefix
+ *   it shares with the previous entry, the length of the remaining suffix, and the suffix itself.
+ * - One record per node in in-order sequence: the difference between its value and the previous
+ *   node's value, followed by the index of its label in the dictionary.
+ *
+ * Since in-order values are strictly increasing and dense, the deltas typically fit in one or
+ * two bytes, and repeated labels cost only their dictionary index.
+ *
+ * Decoding streams the node records straight into a perfectly balanced tree without
+ * re-inserting (and thus without re-balancing) anything.
+ */
+class Snapshot
+{
+public:
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Encodes the tree rooted at the given node into the given stream.
+     *
+     * @param root The root of the tree to be encoded.
+     * @param stream The stream the snapshot will be written to.
+     *
+     * @return `true` if the snapshot was written, `false` otherwise.
+     *
+     * Time complexity: O(n * log(d)) where n is the number of nodes and d the number of distinct labels.
+     * - Every node is visited once, and its label's index is found via a binary search of the dictionary.
+     */
+    static bool Save(const Node* root, std::ostream& stream);
+
+    /**
+     * @brief Decodes a snapshot from the given stream into a new, balanced tree.
+     *
+     * @param stream The stream the snapshot will be read from.
+     * @param tree Set to the decoded tree, its previous nodes destroyed. Left untouched if the snapshot is malformed.
+     *
+     * @return `true` if the snapshot was decoded, `false` otherwise.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the snapshot.
+     * - Nodes arrive in in-order sequence, so each is attached exactly once and no rotations are needed.
+     */
+    static bool Load(std::istream& stream, Tree& tree);
+
+private:
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the most nodes a snapshot may hold: one per 8-digit value.
+     */
+    static constexpr unsigned long long capacity = 100000000;
+
+    //
+    // Typedefs
+    //
+
+    /**
+     * @typedef Dictionary
+     * @brief Represents the sorted, deduplicated labels of a snapshot.
+     * The dictionary is of type `std::vector<Node::Label>`.
+     */
+    using Dictionary = std::vector<Node::Label>;
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Writes the given integer as an unsigned LEB128 varint.
+     *
+     * @param stream The stream to write to.
+     * @param number The integer to be written.
+     *
+     * Time complexity: O(1)
+     * - At most ten bytes are written.
+     */
+    static void Write(std::ostream& stream, unsigned long long number);
+
+    /**
+     * @brief Reads an unsigned LEB128 varint.
+     *
+     * @param stream The stream to read from.
+     * @param number Set to the integer read.
+     *
+     * @return `true` if a well-formed varint was read, `false` otherwise.
+     *
+     * Time complexity: O(1)
+     * - At most ten bytes are read.
+     */
+    static bool Read(std::istream& stream, unsigned long long& number);
+
+    /**
+     * @brief Returns the number of bytes left in the given stream, or the highest possible number if
+     * it isn't seekable.
+     *
+     * Time complexity: O(1)
+     */
+    static unsigned long long Remaining(std::istream& stream);
+
+    /**
+     * @brief Recursively decodes the next `n` node records into a balanced subtree.
+     *
+     * @param stream The stream to read from.
+     * @param labels The handles of the decoded label dictionary, interned.
+     * @param n The number of nodes in the subtree.
+     * @param previous The value of the last decoded node. Updated as nodes are decoded.
+     * @param first Whether no node has been decoded yet.
+     * @param root Set to the root of the decoded subtree.
+     *
+     * @return `true` if every record was well-formed, `false` otherwise.
+     *
+     * Time complexity: O(n)
+     * - The left half, the subtree root, and the right half are each decoded once.
+     */
+    static bool Build(std::istream& stream, const std::vector<Intern::Handle>& labels, unsigned long long n,
+                      Node::Value& previous, bool& first, Node*& root);
+};
+
+#endif //PROJECT_1_SNAPSHOT_H
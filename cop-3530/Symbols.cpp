@@ -0,0 +1,186 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+
+// custom...
+#include "Symbols.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Symbols::Symbols(const std::vector<std::string>& sample)
+{
+    for (std::size_t round = 0; round < rounds; round++)
+    {
+        // The number of bytes of the sample each candidate would cover.
+        std::unordered_map<std::string, std::size_t> gains;
+
+        for (const std::string& label : sample)
+        {
+            std::string previous;
+
+            for (std::size_t i = 0; i < label.size(); )
+            {
+                const std::uint8_t code = Match(label.data() + i, label.size() - i);
+                const std::string piece = (code == escape) ? label.substr(i, 1) : this->symbols[code];
+
+                gains[piece] += piece.size();
+
+                // Bytes stay candidates even when a longer symbol covers them, so no byte is left escaped for good.
+                if (piece.size() > 1)
+                {
+                    gains[label.substr(i, 1)]++;
+                }
+
+                // Symbols that often follow one another make a longer one.
+                if (!previous.empty() && previous.size() + piece.size() <= longest)
+                {
+                    gains[previous + piece] += previous.size() + piece.size();
+                }
+
+                previous = piece;
+                i += piece.size();
+            }
+        }
+
+        std::vector<std::pair<std::size_t, std::string>> ranked;
+        ranked.reserve(gains.size());
+
+        for (auto& gain : gains)
+        {
+            ranked.emplace_back(gain.second, gain.first);
+        }
+
+        // Most bytes covered first; ties broken by the candidates themselves, so training is deterministic.
+        const std::size_t kept = std::min<std::size_t>(ranked.size(), escape);
+
+        std::partial_sort(ranked.begin(), ranked.begin() + kept, ranked.end(), [](const std::pair<std::size_t, std::string>& a, const std::pair<std::size_t, std::string>& b)
+        {
+            return a.first != b.first ? a.first > b.first : a.second < b.second;
+        });
+
+        this->symbols.clear();
+
+        for (std::size_t i = 0; i < kept; i++)
+        {
+            this->symbols.push_back(std::move(ranked[i].second));
+        }
+
+        Index();
+    }
+}
+
+//
+// Methods
+//
+
+void Symbols::Encode(const std::string& label, std::string& output) const
+{
+    for (std::size_t i = 0; i < label.size(); )
+    {
+        const std::uint8_t code = Match(label.data() + i, label.size() - i);
+
+        output.push_back(static_cast<char>(code));
+
+        if (code == escape)
+        {
+            output.push_back(label[i]);
+            i++;
+        }
+
+        else
+        {
+            i += this->symbols[code].size();
+        }
+    }
+}
+
+void Symbols::Decode(const char* bytes, std::size_t size, std::string& output) const
+{
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const std::uint8_t code = static_cast<std::uint8_t>(bytes[i]);
+
+        if (code == escape)
+        {
+            output.push_back(bytes[++i]);
+        }
+
+        else
+        {
+            output.append(this->symbols[code]);
+        }
+    }
+}
+
+std::size_t Symbols::Size() const
+{
+    return this->symbols.size();
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr std::uint8_t Symbols::escape;
+
+constexpr std::size_t Symbols::longest;
+
+constexpr std::size_t Symbols::rounds;
+
+//
+// Methods
+//
+
+std::uint8_t Symbols::Match(const char* bytes, std::size_t size) const
+{
+    for (const std::uint8_t code : this->starts[static_cast<std::uint8_t>(bytes[0])])
+    {
+        const std::string& symbol = this->symbols[code];
+
+        if (symbol.size() <= size && std::memcmp(symbol.data(), bytes, symbol.size()) == 0)
+        {
+            return code;
+        }
+    }
+
+    return escape;
+}
+
+void Symbols::Index()
+{
+    for (std::vector<std::uint8_t>& codes : this->starts)
+    {
+        codes.clear();
+    }
+
+    for (std::size_t code = 0; code < this->symbols.size(); code++)
+    {
+        this->starts[static_cast<std::uint8_t>(this->symbols[code][0])].push_back(static_cast<std::uint8_t>(code));
+    }
+
+    for (std::vector<std::uint8_t>& codes : this->starts)
+    {
+        std::stable_sort(codes.begin(), codes.end(), [this](std::uint8_t a, std::uint8_t b)
+        {
+            return this->symbols[a].size() > this->symbols[b].size();
+        });
+    }
+}
@@ -0,0 +1,128 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_SYMBOLS_H
+#define PROJECT_1_SYMBOLS_H
+
+// std...
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class Symbols
+ *
+ * @brief Represents a static table of up to 255 symbols, strings of 1 to 8 bytes, that labels are
+ * compressed against, following FSST (Fast Static Symbol Table) compression.
+ *
+ * A label is compressed by replacing, from left to right, the longest symbol it starts with by the
+ * symbol's 1-byte code; a byte that starts no symbol is escaped, as code 255 followed by the byte.
+ * Decompressing is a lookup per code. Equal labels compress to equal bytes, so compressed labels
+ * are compared without being decompressed.
+ *
+ * The table is trained on a sample of the labels: starting from no symbols, the sample is compressed
+ * a few times over, and each time the symbols, the bytes, and the concatenations of consecutive pairs
+ * of them that cover the most bytes of it become the next table.
+ */
+class Symbols
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs a table trained on the given labels.
+     *
+     * @param sample The labels to be trained on.
+     *
+     * Time complexity: O(r * s) where r is the number of rounds and s the number of bytes of the sample.
+     */
+    explicit Symbols(const std::vector<std::string>& sample);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Appends the given label, compressed, to the given output.
+     *
+     * Time complexity: O(l) where l is the length of the label.
+     */
+    void Encode(const std::string& label, std::string& output) const;
+
+    /**
+     * @brief Appends the given compressed label, decompressed, to the given output.
+     *
+     * @param bytes The compressed label.
+     * @param size The number of bytes of the compressed label.
+     * @param output The string to be appended to.
+     *
+     * Time complexity: O(l) where l is the length of the decompressed label.
+     */
+    void Decode(const char* bytes, std::size_t size, std::string& output) const;
+
+    /**
+     * @brief Returns the number of symbols.
+     *
+     * Time complexity: O(1)
+     */
+    std::size_t Size() const;
+
+private:
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the code preceding an escaped byte.
+     */
+    static constexpr std::uint8_t escape = 255;
+
+    /**
+     * @brief Represents the number of bytes of the longest symbol.
+     */
+    static constexpr std::size_t longest = 8;
+
+    /**
+     * @brief Represents the number of times the sample is compressed while training.
+     */
+    static constexpr std::size_t rounds = 5;
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Returns the code of the longest symbol the given bytes start with, or `escape` if none.
+     *
+     * Time complexity: O(k) where k is the number of symbols starting with the first byte.
+     */
+    std::uint8_t Match(const char* bytes, std::size_t size) const;
+
+    /**
+     * @brief Indexes the symbols by their first byte, longest first.
+     *
+     * Time complexity: O(k * log(k)) where k is the number of symbols.
+     */
+    void Index();
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the symbols, by code.
+     */
+    std::vector<std::string> symbols;
+
+    /**
+     * @brief Represents the codes of the symbols starting with each byte, longest first.
+     */
+    std::vector<std::uint8_t> starts[256];
+};
+
+#endif //PROJECT_1_SYMBOLS_H
@@ -0,0 +1,265 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// sys...
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// custom...
+#include "Table.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Table::Table(bool compact) : compact(compact)
+{
+    Resize(width);
+}
+
+//
+// Methods
+//
+
+void Table::Insert(const Node* node)
+{
+    const std::uint32_t value = node->value;
+    std::size_t slot = Find(value);
+
+    // Already stored; point it to the node.
+    if (slot != this->controls.size())
+    {
+        this->nodes[slot] = node;
+
+        return;
+    }
+
+    const std::size_t limit = this->compact ? this->controls.size() / 8 * 7 : this->controls.size() / 2;
+
+    // Too full to take another slot; grow, or only drop the deleted slots if they're most of it.
+    if (this->used + 1 > limit)
+    {
+        Resize((this->size + 1 > limit / 2) ? this->controls.size() * 2 : this->controls.size());
+    }
+
+    const std::uint64_t hash = Hash::Mix(value);
+    const std::size_t groups = this->controls.size() / width;
+
+    // Take the first vacant slot along the value's probe sequence.
+    std::size_t group = (hash >> 7) & (groups - 1);
+    for (std::size_t i = 1; ; i++)
+    {
+        const std::uint32_t vacant = Vacant(this->controls.data() + group * width);
+
+        if (vacant)
+        {
+            slot = group * width + static_cast<std::size_t>(__builtin_ctz(vacant));
+            break;
+        }
+
+        group = (group + i) & (groups - 1);
+    }
+
+    if (this->controls[slot] == EMPTY)
+    {
+        this->used++;
+    }
+
+    this->controls[slot] = static_cast<std::int8_t>(hash & 0x7f);
+    this->values[slot] = value;
+    this->nodes[slot] = node;
+    this->size++;
+}
+
+void Table::Remove(std::uint32_t value)
+{
+    const std::size_t slot = Find(value);
+
+    if (slot != this->controls.size())
+    {
+        this->controls[slot] = DELETED;
+        this->nodes[slot] = nullptr;
+        this->size--;
+    }
+}
+
+bool Table::Contains(std::uint64_t value) const
+{
+    // Beyond 32 bits; never stored.
+    return !(value >> 32) && Find(static_cast<std::uint32_t>(value)) != this->controls.size();
+}
+
+bool Table::Search(const Node::Value& value) const
+{
+    const std::size_t slot = (value >> 32) ? this->controls.size() : Find(static_cast<std::uint32_t>(value));
+
+    // Found the matching value; successful search!
+    if (slot != this->controls.size())
+    {
+        Node::Print(Intern::Get(this->nodes[slot]->label));
+
+        return true;
+    }
+
+    // No such value; unsuccessful search!
+    Node::PrintFailure();
+
+    return false;
+}
+
+void Table::Rebuild(const Node* root)
+{
+    this->size = 0;
+    this->used = 0;
+
+    this->controls.assign(width, EMPTY);
+    this->values.assign(width, 0);
+    this->nodes.assign(width, nullptr);
+
+    Fill(root);
+}
+
+std::size_t Table::Size() const
+{
+    return this->size;
+}
+
+std::size_t Table::Bytes() const
+{
+    return sizeof(*this)
+        + this->controls.capacity() * sizeof(std::int8_t)
+        + this->values.capacity() * sizeof(std::uint32_t)
+        + this->nodes.capacity() * sizeof(const Node*);
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+constexpr std::size_t Table::width;
+
+constexpr std::int8_t Table::EMPTY;
+
+constexpr std::int8_t Table::DELETED;
+
+//
+// Static Methods
+//
+
+std::uint32_t Table::Match(const std::int8_t* group, std::int8_t control)
+{
+#ifdef __SSE2__
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(control))));
+#else
+    std::uint32_t mask = 0;
+
+    for (std::size_t i = 0; i < width; i++)
+    {
+        mask |= static_cast<std::uint32_t>(group[i] == control) << i;
+    }
+
+    return mask;
+#endif
+}
+
+std::uint32_t Table::Vacant(const std::int8_t* group)
+{
+#ifdef __SSE2__
+    // Empty and deleted slots are the only ones with the sign bit set.
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+#else
+    std::uint32_t mask = 0;
+
+    for (std::size_t i = 0; i < width; i++)
+    {
+        mask |= static_cast<std::uint32_t>(group[i] < 0) << i;
+    }
+
+    return mask;
+#endif
+}
+
+//
+// Methods
+//
+
+std::size_t Table::Find(std::uint32_t value) const
+{
+    const std::uint64_t hash = Hash::Mix(value);
+    const std::int8_t control = static_cast<std::int8_t>(hash & 0x7f);
+    const std::size_t groups = this->controls.size() / width;
+
+    std::size_t group = (hash >> 7) & (groups - 1);
+    for (std::size_t i = 1; ; i++)
+    {
+        const std::int8_t* bytes = this->controls.data() + group * width;
+
+        // Compare the values of the slots whose control byte matches.
+        for (std::uint32_t match = Match(bytes, control); match; match &= match - 1)
+        {
+            const std::size_t slot = group * width + static_cast<std::size_t>(__builtin_ctz(match));
+
+            if (this->values[slot] == value)
+            {
+                return slot;
+            }
+        }
+
+        // An empty slot ends the probe sequence; the value would have been placed there.
+        if (Match(bytes, EMPTY))
+        {
+            return this->controls.size();
+        }
+
+        group = (group + i) & (groups - 1);
+    }
+}
+
+void Table::Resize(std::size_t slots)
+{
+    std::vector<std::int8_t> controls(slots, EMPTY);
+    std::vector<std::uint32_t> values(slots, 0);
+    std::vector<const Node*> nodes(slots, nullptr);
+
+    controls.swap(this->controls);
+    values.swap(this->values);
+    nodes.swap(this->nodes);
+
+    this->size = 0;
+    this->used = 0;
+
+    for (std::size_t slot = 0; slot < controls.size(); slot++)
+    {
+        if (controls[slot] >= 0)
+        {
+            Insert(nodes[slot]);
+        }
+    }
+}
+
+void Table::Fill(const Node* root)
+{
+    // Base case.
+    if (!root)
+    {
+        return;
+    }
+
+    Fill(root->nodeL);
+    Insert(root);
+    Fill(root->nodeR);
+}
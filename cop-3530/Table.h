@@ -0,0 +1,208 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_TABLE_H
+#define PROJECT_1_TABLE_H
+
+// std...
+#include <cstdint>
+#include <vector>
+
+// custom...
+#include "Hash.h"
+#include "Node.h"
+
+/**
+ * @class Table
+ *
+ * @brief Represents an open-addressing hash table from the values of a tree to its nodes, so a
+ * node is found by value in a few probes rather than a descent.
+ *
+ * The table follows the layout of a Swiss table: every slot has a control byte, either marking it
+ * empty or deleted, or holding 7 bits of the hash of its value. The slots are probed 16 at a time,
+ * in groups, by comparing the control bytes of a whole group against the hash at once (with SIMD
+ * where available); only the values of matching slots are compared. Groups are probed
+ * quadratically, and a lookup ends at the first group with an empty slot.
+ *
+ * The table trades memory for speed by how full it may get before it grows: compact tables fill up
+ * to 7/8 of their slots, fast ones only half, which keeps most lookups within their first group.
+ *
+ * The table only holds pointers, so the tree must keep every node at the same address for as long
+ * as its value is stored; `Node::Remove` does, short of copy-on-write.
+ */
+class Table
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs an empty table.
+     *
+     * @param compact Whether to trade speed for memory.
+     *
+     * Time complexity: O(1)
+     */
+    explicit Table(bool compact);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Points the node's value to the node, replacing the node it pointed to, if any.
+     *
+     * Time complexity: O(1) on average.
+     */
+    void Insert(const Node* node);
+
+    /**
+     * @brief Removes the given value.
+     *
+     * Time complexity: O(1) on average.
+     */
+    void Remove(std::uint32_t value);
+
+    /**
+     * @brief Checks if the given value is stored.
+     *
+     * Time complexity: O(1) on average.
+     */
+    bool Contains(std::uint64_t value) const;
+
+    /**
+     * @brief Searches for the given value. If found, the label of its node is printed.
+     * Otherwise, "unsuccessful" is printed. See `Node::Search`.
+     *
+     * @return `true` if the value was found, `false` otherwise.
+     *
+     * Time complexity: O(1) on average.
+     */
+    bool Search(const Node::Value& value) const;
+
+    /**
+     * @brief Empties the table, then points every value of the tree rooted at the given node to its node.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    void Rebuild(const Node* root);
+
+    /**
+     * @brief Returns the number of values stored.
+     *
+     * Time complexity: O(1)
+     */
+    std::size_t Size() const;
+
+    /**
+     * @brief Returns the number of bytes held, the table itself included.
+     *
+     * Time complexity: O(1)
+     */
+    std::size_t Bytes() const;
+
+private:
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Represents the number of slots probed at once.
+     */
+    static constexpr std::size_t width = 16;
+
+    /**
+     * @brief Represents the control byte of an empty slot.
+     */
+    static constexpr std::int8_t EMPTY = -128;
+
+    /**
+     * @brief Represents the control byte of a slot whose value was removed; probes continue past it.
+     */
+    static constexpr std::int8_t DELETED = -2;
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Returns a mask of the slots of the group starting at the given control byte that hold
+     * the given control byte, a bit per slot.
+     *
+     * Time complexity: O(1)
+     */
+    static std::uint32_t Match(const std::int8_t* group, std::int8_t control);
+
+    /**
+     * @brief Returns a mask of the slots of the group starting at the given control byte that are
+     * empty or deleted, a bit per slot.
+     *
+     * Time complexity: O(1)
+     */
+    static std::uint32_t Vacant(const std::int8_t* group);
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Returns the slot of the given value, or the number of slots if it's not stored.
+     *
+     * Time complexity: O(1) on average.
+     */
+    std::size_t Find(std::uint32_t value) const;
+
+    /**
+     * @brief Resizes the table to the given number of slots, a power of two, dropping deleted slots.
+     *
+     * Time complexity: O(n) where n is the number of slots.
+     */
+    void Resize(std::size_t slots);
+
+    /**
+     * @brief Adds every node of the tree rooted at the given node.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `root` tree.
+     */
+    void Fill(const Node* root);
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the control byte of each slot.
+     */
+    std::vector<std::int8_t> controls;
+
+    /**
+     * @brief Represents the value of each full slot.
+     */
+    std::vector<std::uint32_t> values;
+
+    /**
+     * @brief Represents the node of each full slot.
+     */
+    std::vector<const Node*> nodes;
+
+    /**
+     * @brief Represents the number of values stored.
+     */
+    std::size_t size = 0;
+
+    /**
+     * @brief Represents the number of slots not empty, the deleted ones included.
+     */
+    std::size_t used = 0;
+
+    /**
+     * @brief Whether the table trades speed for memory.
+     */
+    bool compact;
+};
+
+#endif //PROJECT_1_TABLE_H
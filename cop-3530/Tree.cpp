@@ -0,0 +1,113 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// custom...
+#include "Tree.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Construct / Destruct
+//
+
+Tree::Tree() : root(nullptr)
+{
+    // Do nothing...
+}
+
+Tree::Tree(Node* root) : root(root)
+{
+    // Do nothing...
+}
+
+Tree::Tree(const Tree& other) : root(Node::Copy(other.Root()))
+{
+    // Do nothing...
+}
+
+Tree::~Tree()
+{
+    Clear();
+}
+
+//
+// Methods
+//
+
+const Node* Tree::Insert(const Node::Value& value, const Node::Label& label)
+{
+    const Node* inserted = nullptr;
+
+    this->root = Node::Insert(this->root, value, label, inserted);
+
+    return inserted;
+}
+
+void Tree::Remove(const Node::Value& value)
+{
+    this->root = Node::Remove(this->root, value);
+}
+
+void Tree::Remove(unsigned int n)
+{
+    this->root = Node::Remove(this->root, n);
+}
+
+void Tree::Clear()
+{
+    Node::Clear(Release());
+}
+
+bool Tree::Search(const Node::Value& value) const
+{
+    return Node::Search(Root(), value);
+}
+
+const Node* Tree::Find(const Node::Value& value) const
+{
+    return Node::Find(Root(), value);
+}
+
+void Tree::Search(const Node::Label& label) const
+{
+    Node::Search(Root(), label);
+}
+
+void Tree::Print(Node::Order order) const
+{
+    Node::Print(Root(), order);
+}
+
+void Tree::Print() const
+{
+    Node::Print(Root());
+}
+
+const Node* Tree::Root() const
+{
+    return this->root.load();
+}
+
+Node* Tree::Root()
+{
+    return this->root.load();
+}
+
+Node* Tree::Exchange(Node* root)
+{
+    return this->root.exchange(root);
+}
+
+Node* Tree::Release()
+{
+    return Exchange(nullptr);
+}
+
+void Tree::Swap(Tree& other)
+{
+    other.root = Exchange(other.root);
+}
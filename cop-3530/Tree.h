@@ -0,0 +1,199 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_TREE_H
+#define PROJECT_1_TREE_H
+
+// std...
+#include <atomic>
+
+// custom...
+#include "Node.h"
+
+/**
+ * @class Tree
+ *
+ * @brief Represents an AVL tree that owns its nodes.
+ *
+ * `Node` only provides the algorithms, as static methods over a root; which nodes belong together,
+ * and when they're freed, is up to whoever holds that root. A tree holds it: it's the only way to
+ * insert, remove, copy, or clear nodes, and destroying the tree destroys every node it still owns.
+ * Any number of trees may coexist, each on its own.
+ *
+ * The root is atomic, so a writer may publish a new one to lock-free readers, who then read the
+ * tree rooted at whichever root they loaded through the static readers of `Node`. Within a
+ * `Node::Scope`, the tree is mutated copy-on-write like any other, so the nodes replaced or
+ * cleared are retired to the scope rather than freed.
+ *
+ * The values and labels are those of `Node`: 32-bit values and interned labels.
+ */
+class Tree
+{
+public:
+
+    //
+    // Construct / Destruct
+    //
+
+    /**
+     * @brief Constructs an empty tree.
+     *
+     * Time complexity: O(1)
+     */
+    Tree();
+
+    /**
+     * @brief Constructs a tree owning the nodes of the tree rooted at the given node.
+     *
+     * @param root The root of the nodes to be owned.
+     *
+     * Time complexity: O(1)
+     */
+    explicit Tree(Node* root);
+
+    /**
+     * @brief Constructs a copy of the given tree, owning its own nodes.
+     *
+     * @param other The tree to be copied.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the `other` tree.
+     */
+    Tree(const Tree& other);
+
+    Tree& operator=(const Tree& other) = delete;
+
+    /**
+     * @brief Destroys every node the tree owns. Nothing is printed.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the tree.
+     */
+    ~Tree();
+
+    //
+    // Methods
+    //
+
+    /**
+     * @brief Inserts a new node with the given value and label. See `Node::Insert`.
+     *
+     * @return The new node, if inserted. Otherwise, `nullptr`.
+     *
+     * Time complexity: O(log n) where n is the number of nodes in the tree.
+     */
+    const Node* Insert(const Node::Value& value, const Node::Label& label);
+
+    /**
+     * @brief Removes the node with the given value. See `Node::Remove`.
+     *
+     * Time complexity: O(log n) where n is the number of nodes in the tree.
+     */
+    void Remove(const Node::Value& value);
+
+    /**
+     * @brief Removes the n-th node via an in-order traversal. See `Node::Remove`.
+     *
+     * Time complexity: O(n * log(n)) where n is the number of nodes in the tree.
+     */
+    void Remove(unsigned int n);
+
+    /**
+     * @brief Destroys every node, leaving the tree empty. Nothing is printed.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the tree.
+     */
+    void Clear();
+
+    /**
+     * @brief Searches for the node with the given value. See `Node::Search`.
+     *
+     * Time complexity: O(log n) where n is the number of nodes in the tree.
+     */
+    bool Search(const Node::Value& value) const;
+
+    /**
+     * @brief Finds the node with the given value. See `Node::Find`.
+     *
+     * Time complexity: O(log n) where n is the number of nodes in the tree.
+     */
+    const Node* Find(const Node::Value& value) const;
+
+    /**
+     * @brief Searches for the node(s) with the given label. See `Node::Search`.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the tree.
+     */
+    void Search(const Node::Label& label) const;
+
+    /**
+     * @brief Prints the nodes' labels in the given order. See `Node::Print`.
+     *
+     * Time complexity: O(n) where n is the number of nodes in the tree.
+     */
+    void Print(Node::Order order) const;
+
+    /**
+     * @brief Prints the level count of the tree. See `Node::Print`.
+     *
+     * Time complexity: O(1)
+     */
+    void Print() const;
+
+    /**
+     * @brief Returns the root of the tree, as readers would load it.
+     *
+     * Time complexity: O(1)
+     */
+    const Node* Root() const;
+
+    /**
+     * @brief Returns the root of the tree, for a working copy to share nodes with. The nodes stay
+     * owned by the tree.
+     *
+     * Time complexity: O(1)
+     */
+    Node* Root();
+
+    /**
+     * @brief Makes the tree rooted at the given node the tree, publishing it to readers at once.
+     * Nothing is freed: the nodes of the previous root are handed back, no longer owned.
+     *
+     * Used when the new nodes share some of the previous ones, as a committed working copy does.
+     *
+     * @param root The root of the nodes to be owned.
+     *
+     * @return The previous root.
+     *
+     * Time complexity: O(1)
+     */
+    Node* Exchange(Node* root);
+
+    /**
+     * @brief Hands back the root of the tree, leaving it empty. The nodes are no longer owned.
+     *
+     * Time complexity: O(1)
+     */
+    Node* Release();
+
+    /**
+     * @brief Exchanges the nodes of the two trees, publishing the other's to readers of this one at once.
+     *
+     * @param other The tree to be swapped with; must not be read meanwhile.
+     *
+     * Time complexity: O(1)
+     */
+    void Swap(Tree& other);
+
+private:
+
+    //
+    // Properties
+    //
+
+    /**
+     * @brief Represents the root node of the tree. Atomic, so writers can publish a new tree to lock-free readers.
+     */
+    std::atomic<Node*> root;
+};
+
+#endif //PROJECT_1_TREE_H
@@ -0,0 +1,162 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+// std...
+#include <algorithm>
+
+// custom...
+#include "Versions.h"
+
+
+//
+// --- Public ---
+//
+
+//
+// Static Methods
+//
+
+Versions::Handle Versions::Acquire()
+{
+    return std::atomic_load(&latest);
+}
+
+Versions::Handle Versions::At(unsigned long long sequence)
+{
+    // Not yet written.
+    if (sequence > Versions::sequence.load())
+    {
+        return nullptr;
+    }
+
+    Handle version = std::atomic_load(&latest);
+
+    if (version->sequence <= sequence)
+    {
+        return version;
+    }
+
+    std::lock_guard<std::mutex> guard(mutex);
+
+    // Find the first retained version published after the sequence; the one before it was the latest then.
+    const auto after = std::upper_bound(history.begin(), history.end(), sequence,
+        [](unsigned long long sequence, const Handle& version) { return sequence < version->sequence; });
+
+    // Expired, or never retained.
+    if (after == history.begin())
+    {
+        return nullptr;
+    }
+
+    return *std::prev(after);
+}
+
+void Versions::Retain(std::size_t window, std::size_t budget)
+{
+    std::lock_guard<std::mutex> guard(mutex);
+
+    Versions::window = window;
+    Versions::budget = budget;
+}
+
+void Versions::Publish(const Tree& tree, std::vector<Node*>& retired)
+{
+    const Node* root = tree.Root();
+
+    const Handle previous = std::atomic_load(&latest);
+
+    // Nothing changed; no need for a new version, the latest one is still the latest after this write.
+    if (root == previous->root && retired.empty())
+    {
+        sequence++;
+
+        return;
+    }
+
+    Version* version = new Version();
+    version->root = root;
+    version->sequence = sequence + 1;
+
+    // Expired versions are only released once the mutex is free, as releasing them locks it.
+    std::vector<Handle> expired;
+
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+
+        Version* last = chain.back();
+        last->garbage = std::move(retired);
+
+        // Labels are interned, and outlive every node; a node holds nothing else.
+        last->bytes += last->garbage.size() * sizeof(Node);
+
+        chain.push_back(version);
+        retired.clear();
+
+        // Retain the previous version, then expire the oldest beyond the window or the budget.
+        history.push_back(previous);
+        retained += last->bytes;
+
+        while (!history.empty() && (history.size() > window || retained > budget))
+        {
+            retained -= history.front()->bytes;
+
+            expired.push_back(std::move(history.front()));
+            history.pop_front();
+        }
+    }
+
+    // Releasing the previous version's last handle may lock the mutex; it must be free by then.
+    std::atomic_store(&latest, std::shared_ptr<Version>(version, Release));
+
+    // Counted only once published, so `At` never hands out the previous version as the one after this write.
+    sequence++;
+}
+
+
+//
+// --- Private ---
+//
+
+//
+// Define Static Properties
+//
+
+std::mutex Versions::mutex;
+
+std::deque<Versions::Version*> Versions::chain = { new Versions::Version() };
+
+std::shared_ptr<Versions::Version> Versions::latest(Versions::chain.front(), Versions::Release);
+
+std::deque<Versions::Handle> Versions::history;
+
+std::size_t Versions::retained = 0;
+
+std::size_t Versions::window = 64;
+
+std::size_t Versions::budget = 64 << 20;
+
+std::atomic<unsigned long long> Versions::sequence(0);
+
+//
+// Static Methods
+//
+
+void Versions::Release(Versions::Version* version)
+{
+    std::lock_guard<std::mutex> guard(mutex);
+
+    version->released = true;
+
+    // Versions are only freed oldest first, as older versions may reach newer versions' garbage.
+    while (!chain.empty() && chain.front()->released)
+    {
+        for (Node* node : chain.front()->garbage)
+        {
+            delete node;
+        }
+
+        delete chain.front();
+        chain.pop_front();
+    }
+}
@@ -0,0 +1,194 @@
+//
+// Created by Aiden Zepp on 2026-10-19.
+//
+
+#ifndef PROJECT_1_VERSIONS_H
+#define PROJECT_1_VERSIONS_H
+
+// std...
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// custom...
+#include "Node.h"
+#include "Tree.h"
+
+/**
+ * @class Versions
+ *
+ * @brief Keeps the persistent versions of the AVL tree published by writers, reclaiming each
+ * once nothing can reach it anymore.
+ *
+ * Writers mutate within a `Node::Scope`, so a write copies only the nodes on the paths it
+ * modifies and leaves the previous tree intact; the result is published as a new version.
+ * Readers `Acquire` a reference-counted handle to the latest version and may traverse it for
+ * as long as they hold the handle, whatever is published meanwhile.
+ *
+ * Every version owns the nodes its successor's write copied or removed: those nodes are
+ * reachable from it (and perhaps older versions) but from no later one. They are thus freed
+ * once the version and every older version have been released.
+ *
+ * The most recent versions are also retained for time-travel reads through `At`, up to a window of
+ * versions and a budget of bytes their exclusive nodes may take; the oldest expire first.
+ */
+class Versions
+{
+public:
+
+    //
+    // Structs
+    //
+
+    /**
+     * @struct Version
+     * @brief Represents a single published version of the tree.
+     */
+    struct Version
+    {
+        /**
+         * @brief The root of the tree as of this version.
+         */
+        const Node* root = nullptr;
+
+        /**
+         * @brief The number of writes done before this version was published, itself included.
+         */
+        unsigned long long sequence = 0;
+
+        /**
+         * @brief The nodes of this version that the successor's write copied or removed.
+         */
+        std::vector<Node*> garbage;
+
+        /**
+         * @brief The approximate number of bytes taken by `garbage`.
+         */
+        std::size_t bytes = 0;
+
+        /**
+         * @brief Whether every handle to this version has been released.
+         */
+        bool released = false;
+    };
+
+    //
+    // Typedefs
+    //
+
+    /**
+     * @typedef Handle
+     * @brief Represents a reader's hold on a version; the version's tree stays intact while held.
+     */
+    using Handle = std::shared_ptr<const Version>;
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Returns a handle to the latest version. Never blocks on writers.
+     *
+     * Time complexity: O(1)
+     */
+    static Handle Acquire();
+
+    /**
+     * @brief Returns a handle to the version that was the latest after the given number of writes.
+     *
+     * @param sequence The number of writes.
+     *
+     * @return The version, or `nullptr` if `sequence` is in the future or its version has expired.
+     *
+     * Time complexity: O(log n) where n is the number of retained versions.
+     */
+    static Handle At(unsigned long long sequence);
+
+    /**
+     * @brief Sets how many past versions are retained for `At`, and how many bytes they may take.
+     * Takes effect as of the next publish.
+     *
+     * @param window The number of past versions.
+     * @param budget The number of bytes.
+     *
+     * Time complexity: O(1)
+     */
+    static void Retain(std::size_t window, std::size_t budget);
+
+    /**
+     * @brief Counts a write and, if it changed anything, publishes its tree as the latest version.
+     * The write is counted only after, so any sequence `At` accepts has its version published.
+     * Must only be called by one writer at a time.
+     *
+     * @param tree The tree after the write.
+     * @param retired The nodes of the previous version the write copied or removed. Emptied by the call.
+     *
+     * Time complexity: O(1)
+     */
+    static void Publish(const Tree& tree, std::vector<Node*>& retired);
+
+private:
+
+    //
+    // Static Methods
+    //
+
+    /**
+     * @brief Marks the given version released once its last handle is, then frees the nodes of
+     * every version that no longer has an older version alive.
+     *
+     * @param version The version whose last handle was released.
+     *
+     * Time complexity: O(n) where n is the number of nodes freed.
+     */
+    static void Release(Version* version);
+
+    //
+    // Static Properties
+    //
+
+    /**
+     * @brief Guards `chain` and the versions in it, and the retention of past versions.
+     */
+    static std::mutex mutex;
+
+    /**
+     * @brief Represents every version not yet freed, oldest first.
+     */
+    static std::deque<Version*> chain;
+
+    /**
+     * @brief Represents the latest version. Always accessed atomically.
+     */
+    static std::shared_ptr<Version> latest;
+
+    /**
+     * @brief Represents the past versions retained for `At`, oldest first. Guarded by `mutex`.
+     */
+    static std::deque<Handle> history;
+
+    /**
+     * @brief Represents the number of bytes taken by the nodes of `history`. Guarded by `mutex`.
+     */
+    static std::size_t retained;
+
+    /**
+     * @brief Represents the most past versions `history` may hold. Guarded by `mutex`.
+     */
+    static std::size_t window;
+
+    /**
+     * @brief Represents the most bytes `history` may take. Guarded by `mutex`.
+     */
+    static std::size_t budget;
+
+    /**
+     * @brief Represents the number of writes done.
+     */
+    static std::atomic<unsigned long long> sequence;
+};
+
+#endif //PROJECT_1_VERSIONS_H
@@ -20,9 +20,7 @@
  * and review how to do command line parsing again.
  *
  */
-int main()
+int main(int argc, char** argv)
 {
-    Clap::Run();
-
-    return 0;
+    return Clap::Run(argc, argv);
 }